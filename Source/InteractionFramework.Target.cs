@@ -11,5 +11,8 @@ public class InteractionFrameworkTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V6;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_7;
 		ExtraModuleNames.Add("InteractionFramework");
+
+		// Interactable state and keyrings replicate with the push model.
+		bWithPushModel = true;
 	}
 }
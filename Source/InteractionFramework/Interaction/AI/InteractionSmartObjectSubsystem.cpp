@@ -0,0 +1,253 @@
+#include "InteractionSmartObjectSubsystem.h"
+#include "Interaction/Interactable.h"
+#include "Interaction/InteractionRegistrySubsystem.h"
+#include "Interaction/InteractionStats.h"
+#include "Interaction/InteractionUtils.h"
+#include "Interaction/Data/InteractionDataAsset.h"
+#include "SmartObjectDefinition.h"
+#include "SmartObjectRequestTypes.h"
+#include "SmartObjectSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+UInteractionSmartObjectSubsystem* UInteractionSmartObjectSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionSmartObjectSubsystem>() : nullptr;
+}
+
+bool UInteractionSmartObjectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UInteractionSmartObjectSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	Collection.InitializeDependency<UInteractionRegistrySubsystem>();
+	Collection.InitializeDependency<USmartObjectSubsystem>();
+}
+
+void UInteractionSmartObjectSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this);
+	if (!Registry || InWorld.GetNetMode() == NM_Client) return;
+
+	// Bound here rather than in Initialize: the SmartObject subsystem only accepts runtime objects once play began.
+	RegisteredHandle = Registry->OnInteractableRegistered.AddUObject(this, &UInteractionSmartObjectSubsystem::HandleInteractableRegistered);
+	UnregisteredHandle = Registry->OnInteractableUnregistered.AddUObject(this, &UInteractionSmartObjectSubsystem::HandleInteractableUnregistered);
+	StateChangedHandle = Registry->OnInteractableStateChanged.AddUObject(this, &UInteractionSmartObjectSubsystem::UpdateEnabled);
+
+	for (const TWeakObjectPtr<UObject>& Interactable : Registry->GetRegisteredInteractables())
+	{
+		HandleInteractableRegistered(Interactable.Get());
+	}
+}
+
+void UInteractionSmartObjectSubsystem::Deinitialize()
+{
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->OnInteractableRegistered.Remove(RegisteredHandle);
+		Registry->OnInteractableUnregistered.Remove(UnregisteredHandle);
+		Registry->OnInteractableStateChanged.Remove(StateChangedHandle);
+	}
+
+	// The SmartObject subsystem tears down its own runtime objects with the world.
+	DEC_DWORD_STAT_BY(STAT_InteractionSmartObjects, HandleByInteractable.Num());
+	DEC_DWORD_STAT_BY(STAT_InteractionReservations, Reservations.Num());
+	InteractableByHandle.Reset();
+	HandleByInteractable.Reset();
+	Reservations.Reset();
+
+	Super::Deinitialize();
+}
+
+USmartObjectSubsystem* UInteractionSmartObjectSubsystem::GetSmartObjectSubsystem() const
+{
+	return USmartObjectSubsystem::GetCurrent(GetWorld());
+}
+
+void UInteractionSmartObjectSubsystem::HandleInteractableRegistered(UObject* Interactable)
+{
+	const IInteractable* AsInteractable = Cast<IInteractable>(Interactable);
+	if (!AsInteractable || AsInteractable->HasInteractionItems() || HandleByInteractable.Contains(Interactable)) return;
+
+	// Interactables with states report their UInteractionDataAsset as the persistent data asset.
+	const UInteractionDataAsset* Data = Cast<UInteractionDataAsset>(AsInteractable->GetPersistentDataAsset());
+	const USmartObjectDefinition* Definition = Data ? Data->SmartObjectDefinition.Get() : nullptr;
+	USmartObjectSubsystem* SmartObjects = GetSmartObjectSubsystem();
+	if (!Definition || !SmartObjects) return;
+
+	const AActor* Actor = InteractionUtils::GetInteractableActor(Interactable);
+	const FTransform Transform = Actor ? Actor->GetActorTransform() : FTransform(InteractionUtils::GetInteractableLocation(Interactable));
+
+	const FSmartObjectHandle Handle = SmartObjects->CreateSmartObject(*Definition, Transform, FConstStructView());
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogInteractionFramework, Warning, TEXT("Could not create a smart object for %s."), *GetNameSafe(Interactable));
+		return;
+	}
+
+	InteractableByHandle.Add(Handle, Interactable);
+	HandleByInteractable.Add(Interactable, Handle);
+	INC_DWORD_STAT(STAT_InteractionSmartObjects);
+
+	UpdateEnabled(Interactable);
+}
+
+void UInteractionSmartObjectSubsystem::HandleInteractableUnregistered(UObject* Interactable)
+{
+	FSmartObjectHandle Handle;
+	if (!HandleByInteractable.RemoveAndCopyValue(Interactable, Handle)) return;
+
+	// Destroying the smart object invalidates its claims, the agents notice through their reservations.
+	const TObjectKey<UObject> Key(Interactable);
+	for (auto It = Reservations.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Interactable == Key)
+		{
+			It.RemoveCurrent();
+			DEC_DWORD_STAT(STAT_InteractionReservations);
+		}
+	}
+
+	InteractableByHandle.Remove(Handle);
+	DEC_DWORD_STAT(STAT_InteractionSmartObjects);
+
+	if (USmartObjectSubsystem* SmartObjects = GetSmartObjectSubsystem())
+	{
+		SmartObjects->DestroySmartObject(Handle);
+	}
+}
+
+void UInteractionSmartObjectSubsystem::UpdateEnabled(UObject* Interactable)
+{
+	const FSmartObjectHandle* Handle = HandleByInteractable.Find(Interactable);
+	USmartObjectSubsystem* SmartObjects = Handle ? GetSmartObjectSubsystem() : nullptr;
+	if (!SmartObjects) return;
+
+	const IInteractable* AsInteractable = Cast<IInteractable>(Interactable);
+	SmartObjects->SetEnabled(*Handle, AsInteractable && AsInteractable->IsAvailableToAI());
+}
+
+bool UInteractionSmartObjectSubsystem::FindAndClaim(AActor* User, const FVector& Origin, float Radius, FInteractionReservation& OutReservation)
+{
+	USmartObjectSubsystem* SmartObjects = GetSmartObjectSubsystem();
+	if (!SmartObjects || HandleByInteractable.IsEmpty()) return false;
+
+	PruneReservations();
+
+	// Indexed lookup; one result per free slot of the enabled objects.
+	const FSmartObjectRequest Request(FBox::BuildAABB(Origin, FVector(Radius)), FSmartObjectRequestFilter());
+	TArray<FSmartObjectRequestResult> Results;
+	if (!SmartObjects->FindSmartObjects(Request, Results, FConstStructView()))
+	{
+		return false;
+	}
+
+	struct FCandidate
+	{
+		UObject* Interactable;
+		FSmartObjectSlotHandle SlotHandle;
+		double DistSq;
+	};
+
+	TArray<FCandidate, TInlineAllocator<16>> Candidates;
+	for (const FSmartObjectRequestResult& Result : Results)
+	{
+		UObject* Interactable = InteractableByHandle.FindRef(Result.SmartObjectHandle).Get();
+		if (!Interactable || Reservations.Contains(Result.SlotHandle)) continue;
+
+		const double DistSq = FVector::DistSquared(Origin, InteractionUtils::GetInteractableLocation(Interactable));
+		if (DistSq <= FMath::Square(Radius))
+		{
+			Candidates.Add({ Interactable, Result.SlotHandle, DistSq });
+		}
+	}
+
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistSq < B.DistSq; });
+
+	for (const FCandidate& Candidate : Candidates)
+	{
+		// The enabled flag follows pushed state changes, re-check in case one was missed (e.g. not initialized yet).
+		const IInteractable* AsInteractable = Cast<IInteractable>(Candidate.Interactable);
+		if (!AsInteractable || !AsInteractable->IsAvailableToAI()) continue;
+
+		const FSmartObjectClaimHandle ClaimHandle = SmartObjects->MarkSlotAsClaimed(Candidate.SlotHandle, ESmartObjectClaimPriority::Normal);
+		if (!ClaimHandle.IsValid()) continue;
+
+		const TOptional<FVector> SlotLocation = SmartObjects->GetSlotLocation(ClaimHandle);
+
+		OutReservation.Interactable = Candidate.Interactable;
+		OutReservation.ClaimHandle = ClaimHandle;
+		OutReservation.Location = SlotLocation.IsSet() ? SlotLocation.GetValue() : InteractionUtils::GetInteractableLocation(Candidate.Interactable);
+
+		Reservations.Add(Candidate.SlotHandle, { Candidate.Interactable, User, ClaimHandle });
+		INC_DWORD_STAT(STAT_InteractionReservations);
+		return true;
+	}
+
+	return false;
+}
+
+void UInteractionSmartObjectSubsystem::Release(FInteractionReservation& Reservation)
+{
+	// A reservation whose smart object was destroyed (interactable unregistered) or that was pruned has nothing left to free.
+	const FReservationEntry* Entry = Reservation.ClaimHandle.IsValid() ? Reservations.Find(Reservation.ClaimHandle.SlotHandle) : nullptr;
+	if (Entry && Entry->ClaimHandle == Reservation.ClaimHandle)
+	{
+		if (USmartObjectSubsystem* SmartObjects = GetSmartObjectSubsystem())
+		{
+			SmartObjects->MarkSlotAsFree(Reservation.ClaimHandle);
+		}
+
+		Reservations.Remove(Reservation.ClaimHandle.SlotHandle);
+		DEC_DWORD_STAT(STAT_InteractionReservations);
+	}
+
+	Reservation = FInteractionReservation();
+}
+
+void UInteractionSmartObjectSubsystem::PruneReservations()
+{
+	USmartObjectSubsystem* SmartObjects = GetSmartObjectSubsystem();
+
+	for (auto It = Reservations.CreateIterator(); It; ++It)
+	{
+		if (It->Value.User.IsValid()) continue;
+
+		if (SmartObjects)
+		{
+			SmartObjects->MarkSlotAsFree(It->Value.ClaimHandle);
+		}
+		It.RemoveCurrent();
+		DEC_DWORD_STAT(STAT_InteractionReservations);
+	}
+}
+
+AActor* UInteractionSmartObjectSubsystem::GetReservingActor(const UObject* Interactable) const
+{
+	const TObjectKey<UObject> Key(Interactable);
+	for (const TPair<FSmartObjectSlotHandle, FReservationEntry>& Pair : Reservations)
+	{
+		if (Pair.Value.Interactable == Key)
+		{
+			if (AActor* User = Pair.Value.User.Get()) return User;
+		}
+	}
+	return nullptr;
+}
+
+int32 UInteractionSmartObjectSubsystem::GetNumReservationsOf(const UObject* Interactable) const
+{
+	const TObjectKey<UObject> Key(Interactable);
+	int32 Num = 0;
+	for (const TPair<FSmartObjectSlotHandle, FReservationEntry>& Pair : Reservations)
+	{
+		Num += Pair.Value.Interactable == Key ? 1 : 0;
+	}
+	return Num;
+}
@@ -0,0 +1,114 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SmartObjectRuntime.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionSmartObjectSubsystem.generated.h"
+
+class USmartObjectSubsystem;
+
+/** An AI agent's claim on an interactable exposed as a smart object. */
+USTRUCT(BlueprintType)
+struct FInteractionReservation
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Interaction|AI")
+	TWeakObjectPtr<UObject> Interactable;
+
+	UPROPERTY(BlueprintReadOnly, Category="Interaction|AI")
+	FSmartObjectClaimHandle ClaimHandle;
+
+	/** Where the agent should stand: the claimed slot's location. */
+	UPROPERTY(BlueprintReadOnly, Category="Interaction|AI")
+	FVector Location = FVector::ZeroVector;
+
+	bool IsValid() const { return Interactable.IsValid() && ClaimHandle.IsValid(); }
+};
+
+/**
+ * UInteractionSmartObjectSubsystem
+ *
+ * Exposes registered interactables to AI as smart objects, so agents find free interactables through the
+ * SmartObject subsystem's spatial index instead of each agent walking the registry.
+ *
+ * An interactable is exposed when its data asset has a SmartObjectDefinition (objects with items are not).
+ * NPCs are not exposed either: UNpcInteractionDataAsset has no definition and NPC dialogue is meant for players,
+ * so AInteractableNpcActorBase reports itself unavailable to AI.
+ * The smart object is created when the interactable registers and destroyed when it unregisters, and it is
+ * enabled only while the interactable's current state is bAvailableToAI (re-evaluated on the registry's
+ * OnInteractableStateChanged). Claiming a slot reserves that slot for
+ * the claiming agent until the reservation is released; a definition with several slots serves several agents.
+ * Reservations of agents destroyed without releasing them are freed on the next claim.
+ *
+ * Server only: clients do not run AI, so no smart objects are created there.
+ */
+UCLASS()
+class INTERACTIONFRAMEWORK_API UInteractionSmartObjectSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UInteractionSmartObjectSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/**
+	 * Claims the nearest free, available interactable within Radius of Origin for User.
+	 * Returns false when there is none; OutReservation is left untouched then.
+	 */
+	bool FindAndClaim(AActor* User, const FVector& Origin, float Radius, FInteractionReservation& OutReservation);
+
+	/** Frees the slot and drops the reservation. Safe to call with an invalid or already released reservation. */
+	void Release(FInteractionReservation& Reservation);
+
+	/** An agent holding a reservation on one of Interactable's slots, null when every slot is free. */
+	UFUNCTION(BlueprintPure, Category="Interaction|AI")
+	AActor* GetReservingActor(const UObject* Interactable) const;
+
+	/** Number of Interactable's slots reserved by agents. */
+	UFUNCTION(BlueprintPure, Category="Interaction|AI")
+	int32 GetNumReservationsOf(const UObject* Interactable) const;
+
+	UFUNCTION(BlueprintPure, Category="Interaction|AI")
+	int32 GetNumSmartObjects() const { return HandleByInteractable.Num(); }
+
+	UFUNCTION(BlueprintPure, Category="Interaction|AI")
+	int32 GetNumReservations() const { return Reservations.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FReservationEntry
+	{
+		TObjectKey<UObject> Interactable;
+		TWeakObjectPtr<AActor> User;
+		FSmartObjectClaimHandle ClaimHandle;
+	};
+
+	TMap<FSmartObjectHandle, TWeakObjectPtr<UObject>> InteractableByHandle;
+	TMap<TObjectKey<UObject>, FSmartObjectHandle> HandleByInteractable;
+
+	/** Keyed by the claimed slot, so every slot of an interactable can be reserved separately. */
+	TMap<FSmartObjectSlotHandle, FReservationEntry> Reservations;
+
+	FDelegateHandle RegisteredHandle;
+	FDelegateHandle UnregisteredHandle;
+	FDelegateHandle StateChangedHandle;
+
+	USmartObjectSubsystem* GetSmartObjectSubsystem() const;
+
+	void HandleInteractableRegistered(UObject* Interactable);
+	void HandleInteractableUnregistered(UObject* Interactable);
+
+	/** Re-evaluates IInteractable::IsAvailableToAI for Interactable's smart object. Cheap when it has none. */
+	void UpdateEnabled(UObject* Interactable);
+
+	/** Frees the slots of agents that were destroyed while holding a reservation. */
+	void PruneReservations();
+};
@@ -0,0 +1,165 @@
+#include "InteractionStateTreeTasks.h"
+#include "Interaction/InteractionComponent.h"
+#include "Interaction/InteractionUtils.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "StateTreeExecutionContext.h"
+
+namespace
+{
+	UInteractionComponent* GetInteractionComponent(const AAIController* AIController)
+	{
+		const APawn* Pawn = AIController ? AIController->GetPawn() : nullptr;
+		return Pawn ? Pawn->FindComponentByClass<UInteractionComponent>() : nullptr;
+	}
+
+	void EnterPhase(FInteractionUseSmartObjectTaskInstanceData& Data, EInteractionUseSmartObjectPhase NewPhase)
+	{
+		Data.Phase = NewPhase;
+		Data.PhaseTime = 0.f;
+	}
+
+	void UnbindMoveFinished(FInteractionUseSmartObjectTaskInstanceData& Data)
+	{
+		UPathFollowingComponent* PathFollowing = Data.AIController ? Data.AIController->GetPathFollowingComponent() : nullptr;
+		if (PathFollowing && Data.MoveFinishedHandle.IsValid())
+		{
+			PathFollowing->OnRequestFinished.Remove(Data.MoveFinishedHandle);
+		}
+		Data.MoveFinishedHandle.Reset();
+	}
+
+	/** Succeeded once the interaction component executed an interaction since BeginInteract, Running while a hold is in progress. */
+	EStateTreeRunStatus GetInteractStatus(const FInteractionUseSmartObjectTaskInstanceData& Data, const UInteractionComponent& InteractionComp)
+	{
+		if (InteractionComp.GetNumInteractsExecuted() != Data.InteractsBefore) return EStateTreeRunStatus::Succeeded;
+
+		// A hold that lost focus was reset instead of completed.
+		return InteractionComp.IsHolding() ? EStateTreeRunStatus::Running : EStateTreeRunStatus::Failed;
+	}
+}
+
+EStateTreeRunStatus FInteractionUseSmartObjectTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	FInstanceDataType& Data = Context.GetInstanceData(*this);
+	Data.Interactable = nullptr;
+
+	APawn* Pawn = Data.AIController ? Data.AIController->GetPawn() : nullptr;
+	UInteractionSmartObjectSubsystem* SmartObjects = UInteractionSmartObjectSubsystem::Get(Pawn);
+	if (!GetInteractionComponent(Data.AIController) || !SmartObjects) return EStateTreeRunStatus::Failed;
+
+	if (!SmartObjects->FindAndClaim(Pawn, Pawn->GetActorLocation(), Data.SearchRadius, Data.Reservation))
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+	Data.Interactable = Data.Reservation.Interactable.Get();
+
+	FAIMoveRequest MoveRequest(Data.Reservation.Location);
+	MoveRequest.SetAcceptanceRadius(Data.AcceptanceRadius);
+	MoveRequest.SetCanStrafe(false);
+
+	const FPathFollowingRequestResult Move = Data.AIController->MoveTo(MoveRequest);
+	UPathFollowingComponent* PathFollowing = Data.AIController->GetPathFollowingComponent();
+	if (Move.Code == EPathFollowingRequestResult::Failed || !PathFollowing)
+	{
+		SmartObjects->Release(Data.Reservation);
+		return EStateTreeRunStatus::Failed;
+	}
+
+	// A move that is already at its goal finished inside MoveTo, before anything could bind.
+	const TSharedRef<EPathFollowingResult::Type> MoveResult = MakeShared<EPathFollowingResult::Type>(
+		Move.Code == EPathFollowingRequestResult::AlreadyAtGoal ? EPathFollowingResult::Success : EPathFollowingResult::Invalid);
+	Data.MoveResult = MoveResult;
+	if (Move.Code == EPathFollowingRequestResult::RequestSuccessful)
+	{
+		Data.MoveFinishedHandle = PathFollowing->OnRequestFinished.AddLambda(
+			[MoveResult, MoveId = Move.MoveId](FAIRequestID RequestId, const FPathFollowingResult& Result)
+			{
+				if (RequestId == MoveId)
+				{
+					*MoveResult = Result.Code;
+				}
+			});
+	}
+
+	EnterPhase(Data, EInteractionUseSmartObjectPhase::Walking);
+	return EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FInteractionUseSmartObjectTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+	FInstanceDataType& Data = Context.GetInstanceData(*this);
+	Data.PhaseTime += DeltaTime;
+
+	UInteractionComponent* InteractionComp = GetInteractionComponent(Data.AIController);
+	UObject* Target = Data.Reservation.Interactable.Get();
+
+	// The interactable unregistered (destroyed, streamed out, pooled) while we were on our way.
+	if (!InteractionComp || !Target) return EStateTreeRunStatus::Failed;
+
+	switch (Data.Phase)
+	{
+	case EInteractionUseSmartObjectPhase::Walking:
+		if (!Data.MoveResult.IsValid() || *Data.MoveResult == EPathFollowingResult::Invalid)
+		{
+			return EStateTreeRunStatus::Running;
+		}
+		UnbindMoveFinished(Data);
+		// Blocked, off path or aborted by another move request.
+		if (*Data.MoveResult != EPathFollowingResult::Success)
+		{
+			return EStateTreeRunStatus::Failed;
+		}
+		Data.AIController->SetFocalPoint(InteractionUtils::GetInteractableLocation(Target));
+		EnterPhase(Data, EInteractionUseSmartObjectPhase::Focusing);
+		return EStateTreeRunStatus::Running;
+
+	case EInteractionUseSmartObjectPhase::Focusing:
+		if (InteractionComp->GetFocusedInteractable() != Target)
+		{
+			return Data.PhaseTime < Data.FocusTimeout ? EStateTreeRunStatus::Running : EStateTreeRunStatus::Failed;
+		}
+		if (InteractionComp->GetCachedQueryResult().UnmetRequirementNumber > 0)
+		{
+			return EStateTreeRunStatus::Failed;
+		}
+		Data.InteractsBefore = InteractionComp->GetNumInteractsExecuted();
+		InteractionComp->BeginInteract();
+		EnterPhase(Data, EInteractionUseSmartObjectPhase::Interacting);
+		return GetInteractStatus(Data, *InteractionComp);
+
+	case EInteractionUseSmartObjectPhase::Interacting:
+		return GetInteractStatus(Data, *InteractionComp);
+	}
+
+	return EStateTreeRunStatus::Failed;
+}
+
+void FInteractionUseSmartObjectTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	FInstanceDataType& Data = Context.GetInstanceData(*this);
+	UnbindMoveFinished(Data);
+	Data.MoveResult.Reset();
+
+	if (UInteractionComponent* InteractionComp = GetInteractionComponent(Data.AIController))
+	{
+		if (InteractionComp->IsHolding())
+		{
+			InteractionComp->EndInteract();
+		}
+	}
+
+	if (Data.AIController)
+	{
+		if (Data.Phase == EInteractionUseSmartObjectPhase::Walking)
+		{
+			Data.AIController->StopMovement();
+		}
+		Data.AIController->ClearFocus(EAIFocusPriority::Gameplay);
+	}
+
+	if (UInteractionSmartObjectSubsystem* SmartObjects = UInteractionSmartObjectSubsystem::Get(Data.AIController))
+	{
+		SmartObjects->Release(Data.Reservation);
+	}
+}
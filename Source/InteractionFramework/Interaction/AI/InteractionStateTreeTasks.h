@@ -0,0 +1,78 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeTaskBase.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "InteractionSmartObjectSubsystem.h"
+#include "InteractionStateTreeTasks.generated.h"
+
+class AAIController;
+
+UENUM()
+enum class EInteractionUseSmartObjectPhase : uint8
+{
+	Walking,
+	Focusing,
+	Interacting,
+};
+
+USTRUCT()
+struct FInteractionUseSmartObjectTaskInstanceData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category="Context")
+	TObjectPtr<AAIController> AIController = nullptr;
+
+	UPROPERTY(EditAnywhere, Category="Parameter", meta=(ClampMin="0.0"))
+	float SearchRadius = 3000.f;
+
+	/** Passed to the move request. Must stay below the interaction component's TraceDistance. */
+	UPROPERTY(EditAnywhere, Category="Parameter", meta=(ClampMin="0.0"))
+	float AcceptanceRadius = 100.f;
+
+	/** How long to wait for the focus scan to land on the target after arriving. */
+	UPROPERTY(EditAnywhere, Category="Parameter", meta=(ClampMin="0.0"))
+	float FocusTimeout = 2.f;
+
+	/** Interactable that was claimed, for bindings in following states. */
+	UPROPERTY(EditAnywhere, Category="Output")
+	TObjectPtr<UObject> Interactable = nullptr;
+
+	FInteractionReservation Reservation;
+
+	/** Result of the move, Invalid while it runs. Shared with the path following callback, which outlives moves of this data. */
+	TSharedPtr<EPathFollowingResult::Type> MoveResult;
+	FDelegateHandle MoveFinishedHandle;
+
+	/** Interaction component's executed count before BeginInteract, to tell a completed interaction from a reset hold. */
+	uint32 InteractsBefore = 0;
+
+	EInteractionUseSmartObjectPhase Phase = EInteractionUseSmartObjectPhase::Walking;
+	float PhaseTime = 0.f;
+};
+
+/**
+ * FInteractionUseSmartObjectTask
+ *
+ * Finds the nearest free interactable exposed as a smart object, claims it, walks to the claimed slot and
+ * interacts through the agent pawn's UInteractionComponent, the same way a player does: the controller looks at
+ * the target until the focus scan picks it, then BeginInteract runs the press or the whole hold.
+ *
+ * Succeeds once the interaction ran, fails when nothing could be claimed, the move failed, the target never got
+ * focused or its requirements are not met. The reservation is released when the state exits.
+ */
+USTRUCT(meta=(DisplayName="Use Interactable Smart Object", Category="Interaction"))
+struct INTERACTIONFRAMEWORK_API FInteractionUseSmartObjectTask : public FStateTreeTaskCommonBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FInteractionUseSmartObjectTaskInstanceData;
+
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+
+	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+	virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+};
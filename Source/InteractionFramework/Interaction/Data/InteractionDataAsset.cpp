@@ -1,6 +1,48 @@
 ﻿
 #include "InteractionDataAsset.h"
 
+int32 UInteractionDataAsset::FindStateIndexById(FName StateId) const
+{
+	if (StateId.IsNone()) return INDEX_NONE;
+
+	if (StateIndexCacheNum != States.Num())
+	{
+		RebuildStateIndexCache();
+	}
+
+	const int32* Found = StateIndexCache.Find(StateId);
+	if (Found && States.IsValidIndex(*Found) && States[*Found].StateId == StateId)
+	{
+		return *Found;
+	}
+
+	// Entries were edited in place since the cache was built
+	if (Found || StateIndexCache.Num() != States.Num())
+	{
+		RebuildStateIndexCache();
+		Found = StateIndexCache.Find(StateId);
+		return Found ? *Found : INDEX_NONE;
+	}
+
+	return INDEX_NONE;
+}
+
+void UInteractionDataAsset::RebuildStateIndexCache() const
+{
+	StateIndexCache.Reset();
+	StateIndexCache.Reserve(States.Num());
+
+	// First entry wins for duplicate ids, same as a linear scan.
+	for (int32 i = 0; i < States.Num(); ++i)
+	{
+		if (!StateIndexCache.Contains(States[i].StateId))
+		{
+			StateIndexCache.Add(States[i].StateId, i);
+		}
+	}
+	StateIndexCacheNum = States.Num();
+}
+
 #if WITH_EDITOR
 
 #include "Misc/DataValidation.h"
@@ -26,6 +68,11 @@ EDataValidationResult UInteractionDataAsset::IsDataValid(FDataValidationContext&
 		return Result;
 	}
 
+	if (States.Num() > MAX_uint8 + 1)
+	{
+		AddWarning(FString::Printf(TEXT("States has %d entries; instanced interactables only address the first %d."), States.Num(), MAX_uint8 + 1));
+	}
+
 	// Check state IDs and duplicates
 	TSet<FName> Seen;
 	for (int32 i = 0; i < States.Num(); ++i)
@@ -111,6 +158,8 @@ void UInteractionDataAsset::PostEditChangeProperty(FPropertyChangedEvent& Proper
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	StateIndexCacheNum = INDEX_NONE;
+
 	if (DefaultStateId.IsNone() || !FindStateById(DefaultStateId))
 	{
 		for (const FInteractionStateDefinition& State : States)
@@ -5,6 +5,8 @@
 #include "InteractionTypes.h"
 #include "InteractionDataAsset.generated.h"
 
+class USmartObjectDefinition;
+
 /** Prompt visibility for an interaction object */
 UENUM(BlueprintType)
 enum class EInteractionPromptOverride : uint8
@@ -46,6 +48,10 @@ struct FInteractionStateDefinition
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interaction|State")
 	bool bShouldShowRequirements = true;
 
+	/** AI agents may claim the interactable while it is in this state (only used with a SmartObjectDefinition). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interaction|State|AI")
+	bool bAvailableToAI = true;
+
 	/** State is valid if it has a non-None id. */
 	bool IsValid() const { return !StateId.IsNone(); }
 };
@@ -81,20 +87,24 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interaction")
 	TArray<FInteractionStateDefinition> States;
 
+	/**
+	 * When set, interactables using this asset are exposed to AI as smart objects of this definition.
+	 * The smart object is enabled while the current state is bAvailableToAI. Objects with items are not exposed.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interaction|AI")
+	TObjectPtr<USmartObjectDefinition> SmartObjectDefinition;
+
 public:
 	/** Finds a state by id. Returns null if not found. */
 	const FInteractionStateDefinition* FindStateById(FName StateId) const
 	{
-		for (const FInteractionStateDefinition& State : States)
-		{
-			if (State.StateId == StateId)
-			{
-				return &State;
-			}
-		}
-		return nullptr;
+		const int32 Index = FindStateIndexById(StateId);
+		return Index != INDEX_NONE ? &States[Index] : nullptr;
 	}
 
+	/** Index of a state in States, INDEX_NONE if not found. Uses a lazily built id -> index table. */
+	int32 FindStateIndexById(FName StateId) const;
+
 	/** Returns the default state definition (may be null if none defined). */
 	FName GetDefaultStateId() const
 	{
@@ -135,4 +145,11 @@ public:
 	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
+
+private:
+	/** Built on first lookup and rebuilt when States changes size or an entry no longer matches. */
+	mutable TMap<FName, int32> StateIndexCache;
+	mutable int32 StateIndexCacheNum = INDEX_NONE;
+
+	void RebuildStateIndexCache() const;
 };
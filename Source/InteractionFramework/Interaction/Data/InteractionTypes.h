@@ -10,6 +10,49 @@ enum class EInteractionInputType : uint8
 	Hold  UMETA(DisplayName="Hold")
 };
 
+/**
+ * Significance tier of an interactable relative to the local interactors.
+ * Assigned by the registry's budgeted significance pass; lower tiers do less work.
+ */
+UENUM(BlueprintType)
+enum class EInteractionLodTier : uint8
+{
+	/** Full behavior. */
+	Near UMETA(DisplayName="Near"),
+	/** Still interactable, but cosmetics (speech bubbles, BP focus hooks) are skipped. */
+	Mid  UMETA(DisplayName="Mid"),
+	/** Additionally dropped from focus candidates. */
+	Far  UMETA(DisplayName="Far"),
+	Count UMETA(Hidden)
+};
+
+/**
+ * Presentation fields of a query result that differ between two results.
+ * Used by UI code to push only the parts of the prompt that actually changed.
+ */
+enum class EInteractionQueryChange : uint8
+{
+	None         = 0,
+	Visibility   = 1 << 0, // bShouldShowPrompt
+	PromptText   = 1 << 1, // PromptText
+	InputType    = 1 << 2, // InputType, HoldDuration
+	Requirements = 1 << 3, // UnmetRequirementMessages, UnmetRequirementNumber, bShouldShowRequirements
+
+	Content = PromptText | InputType | Requirements,
+	All     = Visibility | Content
+};
+ENUM_CLASS_FLAGS(EInteractionQueryChange)
+
+/**
+ * Persisted per-interactable flags stored next to the state index.
+ */
+enum class EInteractionPersistFlags : uint8
+{
+	None     = 0,
+	Consumed = 1 << 0, // Picked up; must not come back on stream-in
+};
+ENUM_CLASS_FLAGS(EInteractionPersistFlags)
+
 /**
  * A single key requirement entry.
  */
@@ -101,4 +144,58 @@ public:
 	{
 		return UnmetRequirementMessages.Num() == 0;
 	}
+
+	/** Field-level diff against a previously presented result. */
+	EInteractionQueryChange GetChangesFrom(const FInteractionQueryResult& Previous) const
+	{
+		EInteractionQueryChange Changes = EInteractionQueryChange::None;
+
+		if (bShouldShowPrompt != Previous.bShouldShowPrompt)
+		{
+			Changes |= EInteractionQueryChange::Visibility;
+		}
+
+		if (!TextMatches(PromptText, Previous.PromptText))
+		{
+			Changes |= EInteractionQueryChange::PromptText;
+		}
+
+		if (InputType != Previous.InputType || HoldDuration != Previous.HoldDuration)
+		{
+			Changes |= EInteractionQueryChange::InputType;
+		}
+
+		if (UnmetRequirementNumber != Previous.UnmetRequirementNumber
+			|| bShouldShowRequirements != Previous.bShouldShowRequirements
+			|| !TextArraysMatch(UnmetRequirementMessages, Previous.UnmetRequirementMessages))
+		{
+			Changes |= EInteractionQueryChange::Requirements;
+		}
+
+		return Changes;
+	}
+
+private:
+	// Data asset texts are shared, so the identity check catches most cases without a string compare.
+	static bool TextMatches(const FText& A, const FText& B)
+	{
+		return A.IdenticalTo(B) || A.ToString().Equals(B.ToString(), ESearchCase::CaseSensitive);
+	}
+
+	static bool TextArraysMatch(const TArray<FText>& A, const TArray<FText>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			if (!TextMatches(A[i], B[i]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
 };
@@ -0,0 +1,475 @@
+#include "InteractionBenchmark.h"
+
+#if WITH_AUTOMATION_TESTS
+
+#include "InteractionBenchmarkActor.h"
+#include "Interaction/KeyringComponent.h"
+#include "Interaction/Data/InteractionDataAsset.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMisc.h"
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectGlobals.h"
+
+double FInteractionBenchmarkSamples::GetMean() const
+{
+	if (Samples.Num() == 0) return 0.0;
+
+	double Sum = 0.0;
+	for (const double Sample : Samples)
+	{
+		Sum += Sample;
+	}
+	return Sum / Samples.Num();
+}
+
+double FInteractionBenchmarkSamples::GetPercentile(double Percentile) const
+{
+	if (Samples.Num() == 0) return 0.0;
+
+	TArray<double> Sorted = Samples;
+	Sorted.Sort();
+
+	// Nearest rank
+	const int32 Rank = FMath::CeilToInt(FMath::Clamp(Percentile, 0.0, 1.0) * Sorted.Num());
+	return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+}
+
+TSharedRef<FJsonObject> FInteractionBenchmarkSamples::ToJson() const
+{
+	TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetNumberField(TEXT("samples"), Samples.Num());
+	Json->SetNumberField(TEXT("mean_us"), GetMean());
+	Json->SetNumberField(TEXT("p99_us"), GetPercentile(0.99));
+	return Json;
+}
+
+TSharedRef<FJsonObject> FInteractionMicroBenchmarkResult::ToJson() const
+{
+	TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetNumberField(TEXT("ops"), NumOps);
+	Json->SetNumberField(TEXT("ns_per_op"), NsPerOp);
+	Json->SetNumberField(TEXT("allocs_per_op"), AllocsPerOp);
+	return Json;
+}
+
+FInteractionAllocationCounter::FInteractionAllocationCounter()
+	: Inner(GMalloc)
+{
+	check(IsInGameThread());
+	checkf(Inner && FCString::Strcmp(Inner->GetDescriptiveName(), GetDescriptiveName()) != 0, TEXT("Only one allocation counter can be installed at a time."));
+	GMalloc = this;
+}
+
+FInteractionAllocationCounter::~FInteractionAllocationCounter()
+{
+	check(GMalloc == this);
+	GMalloc = Inner;
+}
+
+void FInteractionAllocationCounter::Start()
+{
+	bCounting = true;
+}
+
+void FInteractionAllocationCounter::Stop()
+{
+	bCounting = false;
+}
+
+void FInteractionAllocationCounter::Reset()
+{
+	NumAllocations = 0;
+	NetBytes = 0;
+}
+
+SIZE_T FInteractionAllocationCounter::GetSize(void* Ptr, SIZE_T Fallback) const
+{
+	SIZE_T Size = 0;
+	return (Ptr && Inner->GetAllocationSize(Ptr, Size)) ? Size : Fallback;
+}
+
+void* FInteractionAllocationCounter::Malloc(SIZE_T Count, uint32 Alignment)
+{
+	void* Result = Inner->Malloc(Count, Alignment);
+	if (ShouldCount())
+	{
+		++NumAllocations;
+		NetBytes += GetSize(Result, Count);
+	}
+	return Result;
+}
+
+void* FInteractionAllocationCounter::Realloc(void* Original, SIZE_T Count, uint32 Alignment)
+{
+	if (!ShouldCount())
+	{
+		return Inner->Realloc(Original, Count, Alignment);
+	}
+
+	// Without allocator sizes a shrinking or freeing realloc is not tracked.
+	const SIZE_T OldSize = GetSize(Original, 0);
+	void* Result = Inner->Realloc(Original, Count, Alignment);
+
+	if (Count > 0)
+	{
+		++NumAllocations;
+	}
+	NetBytes += static_cast<int64>(GetSize(Result, Count > 0 ? Count : 0)) - static_cast<int64>(OldSize);
+	return Result;
+}
+
+void FInteractionAllocationCounter::Free(void* Original)
+{
+	if (ShouldCount())
+	{
+		NetBytes -= GetSize(Original, 0);
+	}
+	Inner->Free(Original);
+}
+
+FInteractionBenchmarkWorld::FInteractionBenchmarkWorld()
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("InteractionBenchmarkWorld"));
+
+	FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+}
+
+FInteractionBenchmarkWorld::~FInteractionBenchmarkWorld()
+{
+	Interactables.Empty();
+	DataAssets.Empty();
+
+	if (World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World = nullptr;
+	}
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+void FInteractionBenchmarkWorld::Tick(float DeltaSeconds)
+{
+	World->Tick(LEVELTICK_All, DeltaSeconds);
+	++FrameIndex;
+}
+
+void FInteractionBenchmarkWorld::CreateDataAssets(int32 NumVariants)
+{
+	DataAssets.Reset(NumVariants);
+
+	for (int32 Variant = 0; Variant < NumVariants; ++Variant)
+	{
+		UInteractionDataAsset* DA = NewObject<UInteractionDataAsset>(World);
+		DA->DisplayName = FText::FromString(FString::Printf(TEXT("Benchmark %d"), Variant));
+
+		FInteractionStateDefinition Closed;
+		Closed.StateId = "Closed";
+		Closed.PromptText = FText::FromString(TEXT("Open"));
+		Closed.bShouldShowPrompt = (Variant % 5) != 4;
+
+		// 0-3 requirements; interactors own the first two keys, so three requirements is never met.
+		for (int32 i = 0; i < Variant % 4; ++i)
+		{
+			FInteractionKeyRequirement Requirement;
+			Requirement.KeyId = InteractionBenchmark::GetKeyId(i);
+			Requirement.MissingMessage = FText::FromString(FString::Printf(TEXT("Missing key %d"), i));
+			Closed.RequiredKeys.Add(Requirement);
+		}
+
+		FInteractionStateDefinition Open;
+		Open.StateId = "Open";
+		Open.PromptText = FText::FromString(TEXT("Close"));
+
+		DA->States = { Closed, Open };
+		DataAssets.Add(DA);
+	}
+}
+
+void FInteractionBenchmarkWorld::SpawnInteractableGrid(int32 Count, float Spacing)
+{
+	if (DataAssets.Num() == 0)
+	{
+		CreateDataAssets(8);
+	}
+
+	const int32 Side = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count))));
+	GridHalfExtent = 0.5f * Side * Spacing;
+
+	Interactables.Reserve(Interactables.Num() + Count);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVector Location(
+			(i % Side) * Spacing - GridHalfExtent,
+			(i / Side) * Spacing - GridHalfExtent,
+			0.f);
+
+		AInteractionBenchmarkActor* Actor = World->SpawnActorDeferred<AInteractionBenchmarkActor>(
+			AInteractionBenchmarkActor::StaticClass(), FTransform(Location));
+		if (!Actor) continue;
+
+		Actor->InteractionData = DataAssets[i % DataAssets.Num()];
+		Actor->FinishSpawning(FTransform(Location));
+		Interactables.Add(Actor);
+	}
+}
+
+UInteractionComponent* FInteractionBenchmarkWorld::SpawnInteractor(const FVector& Location, bool bFlightRecorder)
+{
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Interactor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), Params);
+	if (!Interactor) return nullptr;
+
+	USceneComponent* Root = NewObject<USceneComponent>(Interactor, TEXT("Root"));
+	Interactor->SetRootComponent(Root);
+	Root->RegisterComponent();
+	Interactor->SetActorLocation(Location);
+
+	UKeyringComponent* Keyring = NewObject<UKeyringComponent>(Interactor, TEXT("Keyring"));
+	Keyring->RegisterComponent();
+	Keyring->AddKey(InteractionBenchmark::GetKeyId(0));
+	Keyring->AddKey(InteractionBenchmark::GetKeyId(1));
+
+	UInteractionComponent* Comp = NewObject<UInteractionComponent>(Interactor, TEXT("Interaction"));
+	// Benchmark interactors are not player controlled, so recording has to be forced on.
+	Comp->bFlightRecordAllInteractors = bFlightRecorder;
+	if (!bFlightRecorder)
+	{
+		Comp->FlightRecorderCapacity = 0;
+	}
+	Comp->RegisterComponent();
+
+	// Benchmarks drive the scan directly.
+	FInteractionBenchmarkAccess::StopFocusScan(*Comp);
+
+	return Comp;
+}
+
+void FInteractionCrowdScenario::SpawnInteractables(FInteractionBenchmarkWorld& BenchWorld) const
+{
+	BenchWorld.SpawnInteractableGrid(NumInteractables, GridSpacing);
+}
+
+FVector FInteractionCrowdScenario::MakeAgentLocation(FRandomStream& Random, float HalfExtent) const
+{
+	return FVector(
+		FMath::GridSnap(Random.FRandRange(-HalfExtent, HalfExtent), GridSpacing) + 0.5f * GridSpacing,
+		Random.FRandRange(-HalfExtent, HalfExtent),
+		0.f);
+}
+
+FName InteractionBenchmark::GetKeyId(int32 Index)
+{
+	return FName(TEXT("BenchmarkKey"), Index + 1);
+}
+
+FString InteractionBenchmark::WriteResults(const FString& Name, const TSharedRef<FJsonObject>& Results)
+{
+	Results->SetStringField(TEXT("name"), Name);
+	Results->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Results->SetStringField(TEXT("build_version"), FApp::GetBuildVersion());
+	Results->SetNumberField(TEXT("changelist"), FEngineVersion::Current().GetChangelist());
+	Results->SetStringField(TEXT("build_config"), LexToString(FApp::GetBuildConfiguration()));
+	Results->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	Results->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	if (!FJsonSerializer::Serialize(Results, Writer))
+	{
+		return FString();
+	}
+
+	const FString Path = FPaths::Combine(FPaths::AutomationDir(), TEXT("Interaction"), Name + TEXT(".json"));
+	return FFileHelper::SaveStringToFile(Output, *Path) ? Path : FString();
+}
+
+namespace InteractionBenchmark
+{
+	struct FTrackedMetric
+	{
+		const TCHAR* Path;
+		const TCHAR* Description;
+	};
+
+	// Tolerances live only in the baseline file, under "tolerances".
+	static const FTrackedMetric GTrackedMetrics[] =
+	{
+		{ TEXT("perform_focus_scan.mean_us"),    TEXT("Scan cost (mean us)") },
+		{ TEXT("perform_focus_scan.p99_us"),     TEXT("Scan cost (p99 us)") },
+		{ TEXT("refresh_query.allocs_per_call"), TEXT("Query allocations (per call)") },
+		{ TEXT("memory_per_interactable_bytes"), TEXT("Memory per interactable (bytes)") },
+		{ TEXT("registration_ms"),               TEXT("Registration time (ms)") },
+	};
+
+	/** Reads a number from a dotted path ("refresh_query.allocs_per_call"). */
+	static bool TryGetNumberAtPath(const TSharedPtr<FJsonObject>& Root, const FString& Path, double& OutValue)
+	{
+		TArray<FString> Parts;
+		Path.ParseIntoArray(Parts, TEXT("."));
+		if (Parts.Num() == 0) return false;
+
+		TSharedPtr<FJsonObject> Current = Root;
+		for (int32 i = 0; i < Parts.Num() - 1 && Current.IsValid(); ++i)
+		{
+			const TSharedPtr<FJsonObject>* Child = nullptr;
+			Current = Current->TryGetObjectField(Parts[i], Child) ? *Child : nullptr;
+		}
+
+		return Current.IsValid() && Current->TryGetNumberField(Parts.Last(), OutValue);
+	}
+
+	static TSharedPtr<FJsonObject> LoadBaseline()
+	{
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *GetBaselinePath())) return nullptr;
+
+		TSharedPtr<FJsonObject> Baseline;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+		return FJsonSerializer::Deserialize(Reader, Baseline) ? Baseline : nullptr;
+	}
+}
+
+FString InteractionBenchmark::GetBaselinePath()
+{
+	FString Path;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-InteractionBenchmarkBaseline="), Path))
+	{
+		return Path;
+	}
+	return FPaths::Combine(FPaths::ProjectConfigDir(), TEXT("InteractionBenchmarkBaseline.json"));
+}
+
+bool InteractionBenchmark::IsGateEnabled()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("InteractionBenchmarkGate"));
+}
+
+bool InteractionBenchmark::ShouldUpdateBaseline()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("InteractionBenchmarkUpdateBaseline"));
+}
+
+InteractionBenchmark::FGateResult InteractionBenchmark::CompareToBaseline(const FString& Name, const TSharedRef<FJsonObject>& Results)
+{
+	FGateResult Gate;
+
+	const TSharedPtr<FJsonObject> Baseline = LoadBaseline();
+	const TSharedPtr<FJsonObject>* Benchmarks = nullptr;
+	const TSharedPtr<FJsonObject>* Entry = nullptr;
+	if (!Baseline.IsValid()
+		|| !Baseline->TryGetObjectField(TEXT("benchmarks"), Benchmarks)
+		|| !(*Benchmarks)->TryGetObjectField(Name, Entry))
+	{
+		return Gate;
+	}
+
+	Gate.bHasBaseline = true;
+
+	const TSharedPtr<FJsonObject>* Tolerances = nullptr;
+	Baseline->TryGetObjectField(TEXT("tolerances"), Tolerances);
+
+	Gate.Report = FString::Printf(TEXT("%s vs %s\n%-34s %12s %12s %9s %9s\n"),
+		*Name, *GetBaselinePath(), TEXT("Metric"), TEXT("Baseline"), TEXT("Current"), TEXT("Change"), TEXT("Allowed"));
+
+	for (const FTrackedMetric& Metric : GTrackedMetrics)
+	{
+		double CurrentValue = 0.0;
+		if (!TryGetNumberAtPath(Results, Metric.Path, CurrentValue))
+		{
+			Gate.Report += FString::Printf(TEXT("%-34s %12s\n"), Metric.Description, TEXT("n/a"));
+			continue;
+		}
+
+		// A metric the benchmark reports but the baseline cannot judge would pass silently, so it counts as missing.
+		double BaselineValue = 0.0;
+		double Relative = 0.0;
+		double Absolute = 0.0;
+		const TSharedPtr<FJsonObject>* Tolerance = nullptr;
+		if (!(*Entry)->TryGetNumberField(Metric.Path, BaselineValue)
+			|| !Tolerances || !(*Tolerances)->TryGetObjectField(Metric.Path, Tolerance)
+			|| !(*Tolerance)->TryGetNumberField(TEXT("relative"), Relative)
+			|| !(*Tolerance)->TryGetNumberField(TEXT("absolute"), Absolute))
+		{
+			Gate.Report += FString::Printf(TEXT("%-34s %12s %12.2f\n"), Metric.Description, TEXT("missing"), CurrentValue);
+			Gate.MissingMetrics.Add(FString::Printf(TEXT("%s: %s has no baseline value or tolerance in %s"),
+				*Name, Metric.Description, *GetBaselinePath()));
+			continue;
+		}
+
+		const double Allowed = BaselineValue * (1.0 + Relative) + Absolute;
+		const double Change = BaselineValue > 0.0 ? (CurrentValue / BaselineValue - 1.0) * 100.0 : 0.0;
+		const bool bRegressed = CurrentValue > Allowed;
+
+		Gate.Report += FString::Printf(TEXT("%-34s %12.2f %12.2f %+8.1f%% %9.2f%s\n"),
+			Metric.Description, BaselineValue, CurrentValue, Change, Allowed, bRegressed ? TEXT("  REGRESSED") : TEXT(""));
+
+		if (bRegressed)
+		{
+			Gate.Regressions.Add(FString::Printf(TEXT("%s: %s regressed from %.2f to %.2f (%+.1f%%, allowed up to %.2f)"),
+				*Name, Metric.Description, BaselineValue, CurrentValue, Change, Allowed));
+		}
+	}
+
+	return Gate;
+}
+
+bool InteractionBenchmark::UpdateBaseline(const FString& Name, const TSharedRef<FJsonObject>& Results)
+{
+	TSharedPtr<FJsonObject> Baseline = LoadBaseline();
+	if (!Baseline.IsValid())
+	{
+		Baseline = MakeShared<FJsonObject>();
+	}
+
+	const TSharedPtr<FJsonObject>* ExistingBenchmarks = nullptr;
+	const TSharedPtr<FJsonObject> Benchmarks = Baseline->TryGetObjectField(TEXT("benchmarks"), ExistingBenchmarks)
+		? *ExistingBenchmarks
+		: MakeShared<FJsonObject>();
+
+	const TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+	for (const FTrackedMetric& Metric : GTrackedMetrics)
+	{
+		double Value = 0.0;
+		if (TryGetNumberAtPath(Results, Metric.Path, Value))
+		{
+			Entry->SetNumberField(Metric.Path, Value);
+		}
+	}
+
+	FString BuildVersion;
+	if (Results->TryGetStringField(TEXT("build_version"), BuildVersion))
+	{
+		Entry->SetStringField(TEXT("build_version"), BuildVersion);
+	}
+
+	Benchmarks->SetObjectField(Name, Entry);
+	Baseline->SetObjectField(TEXT("benchmarks"), Benchmarks);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	return FJsonSerializer::Serialize(Baseline.ToSharedRef(), Writer)
+		&& FFileHelper::SaveStringToFile(Output, *GetBaselinePath());
+}
+
+#endif
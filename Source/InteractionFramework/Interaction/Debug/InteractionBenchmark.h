@@ -0,0 +1,288 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_AUTOMATION_TESTS
+
+#include "Interaction/InteractionComponent.h"
+
+class FJsonObject;
+class UInteractionDataAsset;
+class UKeyringComponent;
+class AInteractionBenchmarkActor;
+struct FRandomStream;
+
+/**
+ * Gives benchmarks access to the private scan/query/press steps of UInteractionComponent,
+ * so they can be timed individually instead of through the timer manager.
+ */
+struct FInteractionBenchmarkAccess
+{
+	static void PerformFocusScan(UInteractionComponent& Comp) { Comp.PerformFocusScan(); }
+	static void RefreshQuery(UInteractionComponent& Comp) { Comp.RefreshQuery(); }
+	static void ExecutePress(UInteractionComponent& Comp) { Comp.ExecutePress(); }
+	static void StopFocusScan(UInteractionComponent& Comp) { Comp.StopFocusScan(); }
+};
+
+/** Timing samples of one measured operation, in microseconds. */
+struct INTERACTIONFRAMEWORK_API FInteractionBenchmarkSamples
+{
+	void Reserve(int32 Num) { Samples.Reserve(Num); }
+	void Add(double Microseconds) { Samples.Add(Microseconds); }
+	int32 Num() const { return Samples.Num(); }
+
+	double GetMean() const;
+	double GetPercentile(double Percentile) const;
+
+	/** { "samples", "mean_us", "p99_us" } */
+	TSharedRef<FJsonObject> ToJson() const;
+
+private:
+	TArray<double> Samples;
+};
+
+/** Per-operation cost of operations too cheap to time one call at a time. */
+struct INTERACTIONFRAMEWORK_API FInteractionMicroBenchmarkResult
+{
+	int32 NumOps = 0;
+	double NsPerOp = 0.0;
+	double AllocsPerOp = 0.0;
+
+	/** { "ops", "ns_per_op", "allocs_per_op" } */
+	TSharedRef<FJsonObject> ToJson() const;
+};
+
+/** Measures the wall time of one call and adds it to Samples. */
+struct FInteractionBenchmarkScope
+{
+	explicit FInteractionBenchmarkScope(FInteractionBenchmarkSamples& InSamples)
+		: Samples(InSamples)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FInteractionBenchmarkScope()
+	{
+		Samples.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+	}
+
+private:
+	FInteractionBenchmarkSamples& Samples;
+	uint64 StartCycles;
+};
+
+/**
+ * FInteractionAllocationCounter
+ *
+ * FMalloc proxy installed over GMalloc for its lifetime. Counts allocations and net heap bytes
+ * made by the game thread while counting is enabled; everything is forwarded to the real allocator.
+ * Only one counter can be installed at a time. Not meant for anything but benchmarks.
+ */
+class INTERACTIONFRAMEWORK_API FInteractionAllocationCounter : public FMalloc
+{
+public:
+	FInteractionAllocationCounter();
+	virtual ~FInteractionAllocationCounter() override;
+
+	void Start();
+	void Stop();
+	void Reset();
+
+	uint64 GetNumAllocations() const { return NumAllocations; }
+
+	/** Bytes allocated minus bytes freed while counting. Uses allocator sizes when available. */
+	int64 GetNetBytes() const { return NetBytes; }
+
+	// FMalloc
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override;
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override;
+	virtual void Free(void* Original) override;
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+	virtual void UpdateStats() override { Inner->UpdateStats(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return TEXT("InteractionAllocationCounter"); }
+
+private:
+	FMalloc* Inner = nullptr;
+	uint64 NumAllocations = 0;
+	int64 NetBytes = 0;
+	bool bCounting = false;
+
+	bool ShouldCount() const { return bCounting && IsInGameThread(); }
+	SIZE_T GetSize(void* Ptr, SIZE_T Fallback) const;
+};
+
+/**
+ * FInteractionBenchmarkWorld
+ *
+ * Self-contained game world for headless (-nullrhi) benchmarks.
+ * Created and begun on construction, destroyed with everything spawned in it on destruction.
+ */
+class INTERACTIONFRAMEWORK_API FInteractionBenchmarkWorld
+{
+public:
+	FInteractionBenchmarkWorld();
+	~FInteractionBenchmarkWorld();
+
+	FInteractionBenchmarkWorld(const FInteractionBenchmarkWorld&) = delete;
+	FInteractionBenchmarkWorld& operator=(const FInteractionBenchmarkWorld&) = delete;
+
+	UWorld* GetWorld() const { return World; }
+
+	/**
+	 * Ticks the world (actors, components, timers) once, as the engine loop would.
+	 * The engine's global frame counter is left alone; benchmarks count their own frames.
+	 */
+	void Tick(float DeltaSeconds);
+
+	/** Ticks run so far. */
+	uint64 GetFrameIndex() const { return FrameIndex; }
+
+	/** Generates a small set of data assets covering met, unmet and hidden-prompt states. */
+	void CreateDataAssets(int32 NumVariants);
+
+	/** Spawns Count interactables on a square grid centered on the origin. */
+	void SpawnInteractableGrid(int32 Count, float Spacing);
+
+	/**
+	 * Spawns a bare actor carrying an interaction component and a keyring. Its focus scan timer is stopped.
+	 * Without bFlightRecorder the component records nothing, for runs with many interactors.
+	 */
+	UInteractionComponent* SpawnInteractor(const FVector& Location, bool bFlightRecorder = true);
+
+	const TArray<AInteractionBenchmarkActor*>& GetInteractables() const { return Interactables; }
+
+	/** Half extent of the spawned grid. */
+	float GetGridHalfExtent() const { return GridHalfExtent; }
+
+private:
+	UWorld* World = nullptr;
+	TArray<UInteractionDataAsset*> DataAssets;
+	TArray<AInteractionBenchmarkActor*> Interactables;
+	float GridHalfExtent = 0.f;
+	uint64 FrameIndex = 0;
+};
+
+/**
+ * FInteractionCrowdScenario
+ *
+ * Setup shared by the crowd stress tests: interactables on a grid, agents placed between its rows.
+ */
+struct INTERACTIONFRAMEWORK_API FInteractionCrowdScenario
+{
+	int32 NumInteractables = 2000;
+	float GridSpacing = 150.f;
+	float FrameDeltaSeconds = 1.f / 60.f;
+
+	void SpawnInteractables(FInteractionBenchmarkWorld& BenchWorld) const;
+
+	/** Random agent location on the grid, between rows so agents do not start inside an interactable. */
+	FVector MakeAgentLocation(FRandomStream& Random, float HalfExtent) const;
+};
+
+namespace InteractionBenchmark
+{
+	/** Key ids handed out by generated data assets and keyrings. */
+	INTERACTIONFRAMEWORK_API FName GetKeyId(int32 Index);
+
+	/**
+	 * Writes Results to <Saved>/Automation/Interaction/<Name>.json, together with build metadata.
+	 * Returns the written path, empty on failure.
+	 */
+	INTERACTIONFRAMEWORK_API FString WriteResults(const FString& Name, const TSharedRef<FJsonObject>& Results);
+
+	/**
+	 * Runs Op(0..NumOps-1) in Repeats timed passes, then once more under an allocation counter.
+	 * ResetOp() runs untimed before every pass so each pass starts from the same state.
+	 */
+	template<typename OpType, typename ResetOpType>
+	FInteractionMicroBenchmarkResult MeasureOps(int32 NumOps, int32 Repeats, OpType&& Op, ResetOpType&& ResetOp)
+	{
+		FInteractionMicroBenchmarkResult Result;
+		Result.NumOps = NumOps;
+		if (NumOps <= 0 || Repeats <= 0) return Result;
+
+		// Warm caches and let containers reach their steady size.
+		ResetOp();
+		for (int32 i = 0; i < NumOps; ++i)
+		{
+			Op(i);
+		}
+
+		uint64 TotalCycles = 0;
+		for (int32 Pass = 0; Pass < Repeats; ++Pass)
+		{
+			ResetOp();
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < NumOps; ++i)
+			{
+				Op(i);
+			}
+			TotalCycles += FPlatformTime::Cycles64() - StartCycles;
+		}
+		Result.NsPerOp = FPlatformTime::ToMilliseconds64(TotalCycles) * 1.0e6 / (static_cast<double>(NumOps) * Repeats);
+
+		ResetOp();
+		{
+			FInteractionAllocationCounter Allocations;
+			Allocations.Start();
+			for (int32 i = 0; i < NumOps; ++i)
+			{
+				Op(i);
+			}
+			Allocations.Stop();
+			Result.AllocsPerOp = static_cast<double>(Allocations.GetNumAllocations()) / NumOps;
+		}
+
+		return Result;
+	}
+
+	/** Checked-in baseline; -InteractionBenchmarkBaseline=<path> overrides it. */
+	INTERACTIONFRAMEWORK_API FString GetBaselinePath();
+
+	/**
+	 * -InteractionBenchmarkGate: compare results against the baseline and fail on regressions.
+	 * Off unless passed; the checked-in baseline has no entries until one is recorded on the reference machine.
+	 */
+	INTERACTIONFRAMEWORK_API bool IsGateEnabled();
+
+	/** -InteractionBenchmarkUpdateBaseline: store results as the new baseline instead of comparing. */
+	INTERACTIONFRAMEWORK_API bool ShouldUpdateBaseline();
+
+	/** Outcome of comparing one benchmark against its baseline. */
+	struct FGateResult
+	{
+		/** The baseline had an entry for this benchmark. */
+		bool bHasBaseline = false;
+
+		/** Readable table of every tracked metric. */
+		FString Report;
+
+		/** One line per metric beyond its tolerance. */
+		TArray<FString> Regressions;
+
+		/** One line per reported metric without a baseline value or tolerance. */
+		TArray<FString> MissingMetrics;
+	};
+
+	/**
+	 * Compares the tracked metrics of Results (scan cost, query allocations, memory per interactable,
+	 * registration time) with the baseline entry for Name. Lower is better for all of them; a metric
+	 * regresses when Current > Baseline * (1 + relative) + absolute, with both tolerances read from the
+	 * baseline file's "tolerances" object, the only place they are defined.
+	 */
+	INTERACTIONFRAMEWORK_API FGateResult CompareToBaseline(const FString& Name, const TSharedRef<FJsonObject>& Results);
+
+	/** Writes the tracked metrics of Results into the baseline entry for Name, keeping other entries. */
+	INTERACTIONFRAMEWORK_API bool UpdateBaseline(const FString& Name, const TSharedRef<FJsonObject>& Results);
+}
+
+#endif
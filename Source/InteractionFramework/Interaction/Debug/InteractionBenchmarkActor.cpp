@@ -0,0 +1,11 @@
+#include "InteractionBenchmarkActor.h"
+#include "Components/BoxComponent.h"
+
+AInteractionBenchmarkActor::AInteractionBenchmarkActor()
+{
+	Collision = CreateDefaultSubobject<UBoxComponent>(TEXT("Collision"));
+	Collision->InitBoxExtent(FVector(50.f));
+	Collision->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	Collision->SetMobility(EComponentMobility::Static);
+	RootComponent = Collision;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interaction/InteractableActorBase.h"
+#include "InteractionBenchmarkActor.generated.h"
+
+class UBoxComponent;
+
+/**
+ * AInteractionBenchmarkActor
+ *
+ * Minimal concrete interactable used by the benchmark and stress automation tests.
+ * A box collider that blocks the interaction trace channel, nothing else.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown)
+class INTERACTIONFRAMEWORK_API AInteractionBenchmarkActor : public AInteractableActorBase
+{
+	GENERATED_BODY()
+
+public:
+	AInteractionBenchmarkActor();
+
+	UPROPERTY(VisibleAnywhere, Category="Interaction")
+	TObjectPtr<UBoxComponent> Collision;
+};
@@ -0,0 +1,201 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Interaction/Debug/InteractionBenchmark.h"
+#include "Interaction/Debug/InteractionBenchmarkActor.h"
+#include "Interaction/InteractionComponent.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+
+namespace InteractionScanBenchmark
+{
+	constexpr float GridSpacing = 150.f;
+	constexpr int32 WarmupSteps = 64;
+	constexpr int32 MeasuredSteps = 2048;
+	constexpr int32 AllocationSteps = 256;
+
+	/**
+	 * Scripted camera path: three laps of a circle over the grid, walking between rows,
+	 * while the view sweeps +-60 degrees around the walking direction.
+	 */
+	void GetPathPoint(int32 Step, int32 NumSteps, float HalfExtent, FVector& OutLocation, FRotator& OutRotation)
+	{
+		const float Alpha = static_cast<float>(Step) / NumSteps;
+		const float Angle = Alpha * 3.f * UE_TWO_PI;
+		const float Radius = 0.6f * HalfExtent;
+
+		OutLocation = FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.f);
+		OutLocation.X = FMath::GridSnap(OutLocation.X, GridSpacing) + 0.5f * GridSpacing;
+
+		const float Yaw = FMath::RadiansToDegrees(Angle) + 90.f + 60.f * FMath::Sin(Step * 0.37f);
+		OutRotation = FRotator(0.f, Yaw, 0.f);
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FInteractionScanBenchmark,
+	"InteractionFramework.Benchmark.Scan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FInteractionScanBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 Count : { 100, 1000, 10000 })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Interactables"), Count));
+		OutTestCommands.Add(FString::FromInt(Count));
+	}
+}
+
+bool FInteractionScanBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractionScanBenchmark;
+
+	const int32 Count = FCString::Atoi(*Parameters);
+	if (!TestTrue(TEXT("Interactable count should be positive"), Count > 0)) return false;
+
+	FInteractionBenchmarkWorld BenchWorld;
+	BenchWorld.CreateDataAssets(8);
+
+	// Level-load cost: spawn, BeginPlay and registry registration of every interactable.
+	double RegistrationMs = 0.0;
+	int64 SpawnNetBytes = 0;
+	{
+		FInteractionAllocationCounter Allocations;
+		Allocations.Start();
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		BenchWorld.SpawnInteractableGrid(Count, GridSpacing);
+
+		RegistrationMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		Allocations.Stop();
+		SpawnNetBytes = Allocations.GetNetBytes();
+	}
+
+	UInteractionComponent* Comp = BenchWorld.SpawnInteractor(FVector::ZeroVector);
+	if (!TestNotNull(TEXT("Interactor should spawn"), Comp)) return false;
+
+	AActor* Interactor = Comp->GetOwner();
+
+	FInteractionBenchmarkSamples ScanSamples;
+	FInteractionBenchmarkSamples QuerySamples;
+	FInteractionBenchmarkSamples PressSamples;
+	ScanSamples.Reserve(MeasuredSteps);
+	QuerySamples.Reserve(MeasuredSteps);
+	PressSamples.Reserve(MeasuredSteps);
+
+	int32 FocusedSteps = 0;
+
+	for (int32 Step = 0; Step < WarmupSteps + MeasuredSteps; ++Step)
+	{
+		const bool bMeasure = Step >= WarmupSteps;
+
+		FVector Location;
+		FRotator Rotation;
+		GetPathPoint(Step, WarmupSteps + MeasuredSteps, BenchWorld.GetGridHalfExtent(), Location, Rotation);
+		Interactor->SetActorLocationAndRotation(Location, Rotation);
+
+		if (bMeasure)
+		{
+			FInteractionBenchmarkScope Scope(ScanSamples);
+			FInteractionBenchmarkAccess::PerformFocusScan(*Comp);
+		}
+		else
+		{
+			FInteractionBenchmarkAccess::PerformFocusScan(*Comp);
+		}
+
+		if (!bMeasure) continue;
+
+		{
+			FInteractionBenchmarkScope Scope(QuerySamples);
+			FInteractionBenchmarkAccess::RefreshQuery(*Comp);
+		}
+
+		// Press only means something with a target; an early-out would skew the numbers.
+		if (Comp->GetFocusedActor())
+		{
+			++FocusedSteps;
+			FInteractionBenchmarkScope Scope(PressSamples);
+			FInteractionBenchmarkAccess::ExecutePress(*Comp);
+		}
+	}
+
+	TestTrue(TEXT("Scripted path should focus at least one interactable"), FocusedSteps > 0);
+
+	// Allocations are counted in a separate pass so the proxy allocator does not skew the timings.
+	uint64 QueryAllocations = 0;
+	{
+		FInteractionAllocationCounter Allocations;
+		for (int32 Step = 0; Step < AllocationSteps; ++Step)
+		{
+			FVector Location;
+			FRotator Rotation;
+			GetPathPoint(Step, AllocationSteps, BenchWorld.GetGridHalfExtent(), Location, Rotation);
+			Interactor->SetActorLocationAndRotation(Location, Rotation);
+			FInteractionBenchmarkAccess::PerformFocusScan(*Comp);
+
+			Allocations.Start();
+			FInteractionBenchmarkAccess::RefreshQuery(*Comp);
+			Allocations.Stop();
+		}
+		QueryAllocations = Allocations.GetNumAllocations();
+	}
+
+	const int32 NumSpawned = BenchWorld.GetInteractables().Num();
+	const double AllocsPerQuery = static_cast<double>(QueryAllocations) / AllocationSteps;
+	const double BytesPerInteractable = NumSpawned > 0 ? static_cast<double>(SpawnNetBytes) / NumSpawned : 0.0;
+
+	const TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	Results->SetNumberField(TEXT("interactables"), Count);
+	Results->SetNumberField(TEXT("steps"), MeasuredSteps);
+	Results->SetNumberField(TEXT("focused_steps"), FocusedSteps);
+	Results->SetObjectField(TEXT("perform_focus_scan"), ScanSamples.ToJson());
+	Results->SetObjectField(TEXT("refresh_query"), QuerySamples.ToJson());
+	Results->SetObjectField(TEXT("execute_press"), PressSamples.ToJson());
+	Results->GetObjectField(TEXT("refresh_query"))->SetNumberField(TEXT("allocs_per_call"), AllocsPerQuery);
+	Results->SetNumberField(TEXT("memory_per_interactable_bytes"), BytesPerInteractable);
+	Results->SetNumberField(TEXT("registration_ms"), RegistrationMs);
+
+	AddInfo(FString::Printf(TEXT("N=%d scan mean %.2fus p99 %.2fus | query mean %.2fus p99 %.2fus | press mean %.2fus p99 %.2fus"),
+		Count,
+		ScanSamples.GetMean(), ScanSamples.GetPercentile(0.99),
+		QuerySamples.GetMean(), QuerySamples.GetPercentile(0.99),
+		PressSamples.GetMean(), PressSamples.GetPercentile(0.99)));
+	AddInfo(FString::Printf(TEXT("N=%d query allocs %.2f/call | %.0f bytes/interactable | registration %.2fms"),
+		Count, AllocsPerQuery, BytesPerInteractable, RegistrationMs));
+
+	const FString Name = FString::Printf(TEXT("ScanBenchmark_%d"), Count);
+	const FString Path = InteractionBenchmark::WriteResults(Name, Results);
+	TestFalse(TEXT("Benchmark results should be written"), Path.IsEmpty());
+	AddInfo(FString::Printf(TEXT("Results written to %s"), *Path));
+
+	if (InteractionBenchmark::ShouldUpdateBaseline())
+	{
+		TestTrue(TEXT("Baseline should be updated"), InteractionBenchmark::UpdateBaseline(Name, Results));
+		AddInfo(FString::Printf(TEXT("Baseline for %s updated in %s"), *Name, *InteractionBenchmark::GetBaselinePath()));
+	}
+	else if (InteractionBenchmark::IsGateEnabled())
+	{
+		const InteractionBenchmark::FGateResult Gate = InteractionBenchmark::CompareToBaseline(Name, Results);
+		// An enabled gate without a baseline to compare against must not pass.
+		if (!Gate.bHasBaseline)
+		{
+			AddError(FString::Printf(TEXT("No baseline for %s in %s; run with -InteractionBenchmarkUpdateBaseline to record one."),
+				*Name, *InteractionBenchmark::GetBaselinePath()));
+		}
+		else
+		{
+			AddInfo(Gate.Report);
+			for (const FString& Missing : Gate.MissingMetrics)
+			{
+				AddError(Missing);
+			}
+			for (const FString& Regression : Gate.Regressions)
+			{
+				AddError(Regression);
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -1,7 +1,11 @@
 ﻿#include "InteractionDebugHelper.h"
 #include "Interaction/InteractionComponent.h"
-#include "DrawDebugHelpers.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
 #include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 
 void UInteractionDebugHelper::Initialize(const UInteractionComponent* InOwnerComp)
 {
@@ -10,139 +14,211 @@ void UInteractionDebugHelper::Initialize(const UInteractionComponent* InOwnerCom
 
 void UInteractionDebugHelper::SetEnabled(bool bInEnabled)
 {
+	if (bEnabled == bInEnabled) return;
+
 	bEnabled = bInEnabled;
 
-	// Clear overlay when disabling
-	if (!bEnabled && GEngine)
+	if (bEnabled)
+	{
+		DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UInteractionDebugHelper::DrawOverlay));
+	}
+	else
 	{
-		GEngine->AddOnScreenDebugMessage(GetMessageKey(), 0.f, FColor::White, TEXT(""));
+		UDebugDrawService::Unregister(DrawHandle);
+		DrawHandle.Reset();
+
+		// Next enable starts from a full rebuild
+		bHasSnapshot = false;
 	}
 }
 
-void UInteractionDebugHelper::Update(const FInteractionDebugSnapshot& Snapshot)
+void UInteractionDebugHelper::BeginDestroy()
 {
-	if (!bEnabled) return;
+	if (DrawHandle.IsValid())
+	{
+		UDebugDrawService::Unregister(DrawHandle);
+		DrawHandle.Reset();
+	}
 
-	Draw(Snapshot);
-	Print(Snapshot);
+	Super::BeginDestroy();
 }
 
-uint64 UInteractionDebugHelper::GetMessageKey() const
+void UInteractionDebugHelper::Update(const FInteractionDebugSnapshot& S)
 {
-	// Onscreen message overwrite key
-	return (uint64)reinterpret_cast<uintptr_t>(this);
-}
+	if (!bEnabled) return;
 
-void UInteractionDebugHelper::Draw(const FInteractionDebugSnapshot& S) const
-{
-	if (!bDrawTrace) return;
+	const bool bFull = !bHasSnapshot;
+	const FInteractionDebugSnapshot& P = Current;
 
-	const UInteractionComponent* Comp = OwnerComp.Get();
-	UWorld* World = Comp ? Comp->GetWorld() : nullptr;
-	if (!World) return;
+	// Work out which sections are stale before overwriting the previous snapshot.
+	const bool bHeaderDirty = bFull || S.Owner != P.Owner || S.bEnabled != P.bEnabled;
+	const bool bFocusDirty = bFull || S.FocusedActor != P.FocusedActor || S.HitActor != P.HitActor
+		|| S.bTraceHit != P.bTraceHit || S.bHitWasInteractable != P.bHitWasInteractable;
+	const bool bQueryDirty = bFull || S.QueryRevision != P.QueryRevision;
+	const bool bHoldDirty = bFull || S.bHolding != P.bHolding || S.HoldProgress01 != P.HoldProgress01;
+	const bool bScanDirty = bFull || S.ScanInterval != P.ScanInterval || S.TraceDistance != P.TraceDistance
+		|| S.TraceRadius != P.TraceRadius;
 
-	DrawDebugLine(World, S.TraceStart, S.TraceEnd, FColor::Cyan, false, DrawDuration, 0, 1.0f);
+	Current = S;
+	bHasSnapshot = true;
 
-	if (S.TraceRadius > 0.f)
+	if (bHeaderDirty) RebuildSection(ESection::Header);
+	if (bFocusDirty)  RebuildSection(ESection::Focus);
+	if (bQueryDirty)
 	{
-		DrawDebugSphere(World, S.TraceEnd, S.TraceRadius, 12, FColor::Cyan, false, DrawDuration);
+		RebuildSection(ESection::Prompt);
+		RebuildSection(ESection::Requirements);
 	}
+	if (bHoldDirty)   RebuildSection(ESection::Hold);
+	if (bScanDirty)   RebuildSection(ESection::Scan);
+}
 
-	if (S.bTraceHit)
+void UInteractionDebugHelper::RebuildSection(ESection Section)
+{
+	const FInteractionDebugSnapshot& S = Current;
+	FString& Out = SectionText[static_cast<int32>(Section)];
+
+	switch (Section)
+	{
+	case ESection::Header:
 	{
-		DrawDebugPoint(World, S.HitResult.ImpactPoint, 12.f, FColor::Green, false, DrawDuration);
-		DrawDebugLine(World,
-			S.HitResult.ImpactPoint,
-			S.HitResult.ImpactPoint + S.HitResult.ImpactNormal * 20.f,
-			FColor::Green, false, DrawDuration, 0, 1.0f);
+		const FString OwnerName = S.Owner.IsValid() ? S.Owner->GetName() : TEXT("None");
+		Out = FString::Printf(TEXT("[Interaction Debug]\nOwner: %s | Enabled: %s"),
+			*OwnerName,
+			S.bEnabled ? TEXT("Yes") : TEXT("No"));
+		break;
+	}
+	case ESection::Focus:
+	{
+		const FString FocusName = S.FocusedActor.IsValid() ? S.FocusedActor->GetName() : TEXT("None");
+		const FString HitName   = S.HitActor.IsValid() ? S.HitActor->GetName() : TEXT("None");
+		Out = FString::Printf(TEXT("Focused: %s\nTraceHit: %s | HitActor: %s | HitInteractable: %s"),
+			*FocusName,
+			S.bTraceHit ? TEXT("Yes") : TEXT("No"),
+			*HitName,
+			S.bHitWasInteractable ? TEXT("Yes") : TEXT("No"));
+		break;
+	}
+	case ESection::Prompt:
+	{
+		const FString InputTypeStr =
+			(S.QueryResult.InputType == EInteractionInputType::Hold) ? TEXT("Hold") : TEXT("Press");
+
+		const FString PromptStr = S.QueryResult.PromptText.IsEmpty()
+			? TEXT("<empty>")
+			: S.QueryResult.PromptText.ToString();
+
+		Out = FString::Printf(TEXT("PromptVisible: %s | Input: %s | HoldDuration: %.2f\nPrompt: %s"),
+			S.QueryResult.bShouldShowPrompt ? TEXT("Yes") : TEXT("No"),
+			*InputTypeStr,
+			S.QueryResult.HoldDuration,
+			*PromptStr);
+		break;
+	}
+	case ESection::Requirements:
+	{
+		const int32 UnmetCount = S.QueryResult.UnmetRequirementNumber;
+
+		// Show up to 3 unmet messages to avoid overlay crowd
+		FString UnmetPreview = TEXT("<none>");
+		const int32 MaxToShow = 3;
+		const int32 NumMessages = S.QueryResult.UnmetRequirementMessages.Num();
+		if (NumMessages > 0)
+		{
+			UnmetPreview.Reset();
+			for (int32 i = 0; i < FMath::Min(NumMessages, MaxToShow); ++i)
+			{
+				if (i > 0) UnmetPreview += TEXT(" | ");
+				UnmetPreview += S.QueryResult.UnmetRequirementMessages[i].ToString();
+			}
+			if (NumMessages > MaxToShow)
+			{
+				UnmetPreview += FString::Printf(TEXT(" | ...(+%d)"), NumMessages - MaxToShow);
+			}
+		}
+
+		Out = FString::Printf(TEXT("Available: %s | Unmet: %d\nUnmetMessages: %s"),
+			S.QueryResult.IsAvailable() ? TEXT("Yes") : TEXT("No"),
+			UnmetCount,
+			*UnmetPreview);
+		break;
+	}
+	case ESection::Hold:
+		Out = FString::Printf(TEXT("Holding: %s | HoldProgress: %.2f"),
+			S.bHolding ? TEXT("Yes") : TEXT("No"),
+			S.HoldProgress01);
+		break;
+
+	case ESection::Scan:
+		Out = FString::Printf(TEXT("Scan: Interval=%.2f Dist=%.0f Radius=%.0f"),
+			S.ScanInterval,
+			S.TraceDistance,
+			S.TraceRadius);
+		break;
+
+	default:
+		break;
 	}
 }
 
-void UInteractionDebugHelper::Print(const FInteractionDebugSnapshot& S)
+void UInteractionDebugHelper::DrawOverlay(UCanvas* Canvas, APlayerController* PC)
 {
-	if (!GEngine) return;
+	if (!bEnabled || !bHasSnapshot || !Canvas || !GEngine) return;
 
-	const UInteractionComponent* Comp = OwnerComp.Get();
-	UWorld* World = Comp ? Comp->GetWorld() : nullptr;
-	if (!World) return;
-
-	const double Now = World->GetTimeSeconds();
-	if (Now - LastPrintTime < PrintInterval)
+	// Only draw into the viewport of the player that owns this interactor.
+	const APawn* OwnerPawn = Cast<APawn>(Current.Owner.Get());
+	if (PC && OwnerPawn && OwnerPawn->GetController() && OwnerPawn->GetController() != PC)
 	{
 		return;
 	}
 
-	LastPrintTime = Now;
+	if (bDrawTrace)
+	{
+		DrawTrace(Canvas);
+	}
 
-	GEngine->AddOnScreenDebugMessage(GetMessageKey(), .2f, FColor::White, BuildString(S));
-}
+	UFont* Font = GEngine->GetSmallFont();
+	const float LineHeight = Font ? Font->GetMaxCharHeight() : 12.f;
+
+	float X = 20.f;
+	float Y = 60.f;
 
+	Canvas->SetDrawColor(FColor::White);
+	for (const FString& Text : SectionText)
+	{
+		if (Text.IsEmpty()) continue;
+
+		float W = 0.f, H = 0.f;
+		Canvas->StrLen(Font, Text, W, H);
+		Canvas->DrawText(Font, Text, X, Y);
+		Y += FMath::Max(H, LineHeight);
+	}
+}
 
-FString UInteractionDebugHelper::BuildString(const FInteractionDebugSnapshot& S) const
+void UInteractionDebugHelper::DrawTrace(UCanvas* Canvas) const
 {
-    const FString OwnerName = S.Owner.IsValid() ? S.Owner->GetName() : TEXT("None");
-    const FString FocusName = S.FocusedActor.IsValid() ? S.FocusedActor->GetName() : TEXT("None");
-    const FString HitName   = S.HitActor.IsValid() ? S.HitActor->GetName() : TEXT("None");
+	const FInteractionDebugSnapshot& S = Current;
+
+	// Projection returns Z <= 0 for points behind the view.
+	const FVector Start = Canvas->Project(S.TraceStart);
+	const FVector End = Canvas->Project(S.TraceEnd);
+	if (Start.Z > 0.f && End.Z > 0.f)
+	{
+		Canvas->K2_DrawLine(FVector2D(Start), FVector2D(End), 1.f, FLinearColor(FColor::Cyan));
+	}
 
-    const FString InputTypeStr =
-        (S.QueryResult.InputType == EInteractionInputType::Hold) ? TEXT("Hold") : TEXT("Press");
+	if (!S.bTraceHit) return;
 
-    const FString PromptStr = S.QueryResult.PromptText.IsEmpty()
-        ? TEXT("<empty>")
-        : S.QueryResult.PromptText.ToString();
+	const FVector Impact = Canvas->Project(S.HitImpactPoint);
+	if (Impact.Z <= 0.f) return;
 
-    const bool bAvailable = S.QueryResult.IsAvailable();
-    const int32 UnmetCount = S.QueryResult.UnmetRequirementNumber;
+	const FVector2D ImpactScreen(Impact);
+	const FVector2D MarkerSize(8.f, 8.f);
+	Canvas->K2_DrawBox(ImpactScreen - MarkerSize * 0.5f, MarkerSize, 2.f, FLinearColor(FColor::Green));
 
-    // Show up to 3 unmet messages to avoid overlay crowd
-    FString UnmetPreview;
-    const int32 MaxToShow = 3;
-	if (S.QueryResult.UnmetRequirementMessages.Num() > 0)
+	const FVector NormalEnd = Canvas->Project(S.HitImpactPoint + S.HitImpactNormal * 20.f);
+	if (NormalEnd.Z > 0.f)
 	{
-		for (int32 i = 0; i < FMath::Min(UnmetCount, MaxToShow); ++i)
-		{
-			if (i > 0) UnmetPreview += TEXT(" | ");
-			UnmetPreview += S.QueryResult.UnmetRequirementMessages[i].ToString();
-		}
-		if (UnmetCount > MaxToShow)
-		{
-			UnmetPreview += FString::Printf(TEXT(" | ...(+%d)"), UnmetCount - MaxToShow);
-		}
-		if (UnmetCount == 0)
-		{
-			UnmetPreview = TEXT("<none>");
-		}
+		Canvas->K2_DrawLine(ImpactScreen, FVector2D(NormalEnd), 1.f, FLinearColor(FColor::Green));
 	}
-	
-    return FString::Printf(
-        TEXT("[Interaction Debug]\n")
-        TEXT("Owner: %s | Enabled: %s\n")
-        TEXT("Focused: %s\n")
-        TEXT("TraceHit: %s | HitActor: %s | HitInteractable: %s\n")
-        TEXT("PromptVisible: %s | Input: %s | HoldDuration: %.2f\n")
-        TEXT("Prompt: %s\n")
-        TEXT("Available: %s | Unmet: %d\n")
-        TEXT("UnmetMessages: %s\n")
-        TEXT("Holding: %s | HoldProgress: %.2f\n")
-        TEXT("Scan: Interval=%.2f Dist=%.0f Radius=%.0f\n"),
-        *OwnerName,
-        S.bEnabled ? TEXT("Yes") : TEXT("No"),
-        *FocusName,
-        S.bTraceHit ? TEXT("Yes") : TEXT("No"),
-        *HitName,
-        S.bHitWasInteractable ? TEXT("Yes") : TEXT("No"),
-        S.QueryResult.bShouldShowPrompt ? TEXT("Yes") : TEXT("No"),
-        *InputTypeStr,
-        S.QueryResult.HoldDuration,
-        *PromptStr,
-        bAvailable ? TEXT("Yes") : TEXT("No"),
-        UnmetCount,
-        *UnmetPreview,
-        S.bHolding ? TEXT("Yes") : TEXT("No"),
-        S.HoldProgress01,
-        S.ScanInterval,
-        S.TraceDistance,
-        S.TraceRadius
-    );
 }
-
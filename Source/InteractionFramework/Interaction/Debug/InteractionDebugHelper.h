@@ -6,6 +6,8 @@
 #include "InteractionDebugHelper.generated.h"
 
 class UInteractionComponent;
+class UCanvas;
+class APlayerController;
 
 USTRUCT()
 struct FInteractionDebugSnapshot
@@ -20,10 +22,14 @@ struct FInteractionDebugSnapshot
 
 	UPROPERTY() bool bTraceHit = false;
 	UPROPERTY() TWeakObjectPtr<const AActor> HitActor;
-	UPROPERTY() FHitResult HitResult;
+	UPROPERTY() FVector HitImpactPoint  = FVector::ZeroVector;
+	UPROPERTY() FVector HitImpactNormal = FVector::ZeroVector;
 
 	UPROPERTY() FInteractionQueryResult QueryResult;
 
+	/** Bumped by the component whenever the cached query is rebroadcast, avoids text compares. */
+	UPROPERTY() uint32 QueryRevision = 0;
+
 	UPROPERTY() bool bEnabled = true;
 	UPROPERTY() bool bHolding = false;
 	UPROPERTY() float HoldProgress01 = 0.f;
@@ -34,6 +40,14 @@ struct FInteractionDebugSnapshot
 	UPROPERTY() bool bHitWasInteractable = false;
 };
 
+/**
+ * UInteractionDebugHelper
+ *
+ * Change-driven debug overlay for an interaction component.
+ * The component only pushes snapshots that differ from the previous one, the helper rebuilds
+ * the text of the sections that changed, and everything is drawn from the cached state
+ * through the "Game" debug draw service.
+ */
 UCLASS()
 class INTERACTIONFRAMEWORK_API UInteractionDebugHelper : public UObject
 {
@@ -46,25 +60,38 @@ public:
 	bool IsEnabled() const { return bEnabled; }
 
 	void SetDrawTrace(bool bInDraw) { bDrawTrace = bInDraw; }
-	void SetDrawDuration(float InSeconds) { DrawDuration = InSeconds; }
 
 	// Main entrypoint
 	void Update(const FInteractionDebugSnapshot& Snapshot);
 
+	virtual void BeginDestroy() override;
+
 private:
+	enum class ESection : uint8
+	{
+		Header,
+		Focus,
+		Prompt,
+		Requirements,
+		Hold,
+		Scan,
+		Num
+	};
+
 	TWeakObjectPtr<const UInteractionComponent> OwnerComp;
 	bool bEnabled = false;
 	bool bDrawTrace = true;
-	float DrawDuration = 0.06f;
 
-	void Draw(const FInteractionDebugSnapshot& Snapshot) const;
-	void Print(const FInteractionDebugSnapshot& Snapshot);
-	FString BuildString(const FInteractionDebugSnapshot& Snapshot) const;
+	/** Last pushed snapshot, drawn every frame. */
+	FInteractionDebugSnapshot Current;
+	bool bHasSnapshot = false;
 
-	uint64 GetMessageKey() const;
+	/** Cached text per section, only rebuilt when the section's inputs change. */
+	FString SectionText[static_cast<int32>(ESection::Num)];
 
-	double LastPrintTime = 0.0;
+	FDelegateHandle DrawHandle;
 
-	UPROPERTY()
-	float PrintInterval = 0.15f;
+	void RebuildSection(ESection Section);
+	void DrawOverlay(UCanvas* Canvas, APlayerController* PC);
+	void DrawTrace(UCanvas* Canvas) const;
 };
@@ -0,0 +1,333 @@
+#include "InteractionFlightRecorder.h"
+#include "Interaction/InteractionComponent.h"
+#include "InteractionFramework.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectIterator.h"
+
+void FInteractionFlightRecorder::Initialize(int32 InCapacity)
+{
+	Records.SetNumZeroed(FMath::Max(InCapacity, 1));
+	Reset();
+}
+
+void FInteractionFlightRecorder::Reset()
+{
+	Head = 0;
+	Count = 0;
+	ActorNames.Reset();
+}
+
+void FInteractionFlightRecorder::Record(const FInteractionFlightRecord& InRecord)
+{
+	if (Records.Num() == 0) return;
+
+	Records[Head] = InRecord;
+	Head = (Head + 1) % Records.Num();
+	Count = FMath::Min(Count + 1, Records.Num());
+}
+
+const FInteractionFlightRecord& FInteractionFlightRecorder::GetRecord(int32 Index) const
+{
+	check(Index >= 0 && Index < Count);
+	const int32 Oldest = (Head - Count + Records.Num()) % Records.Num();
+	return Records[(Oldest + Index) % Records.Num()];
+}
+
+int32 FInteractionFlightRecorder::FindClosestRecord(double Time) const
+{
+	int32 Best = INDEX_NONE;
+	double BestDelta = TNumericLimits<double>::Max();
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const double Delta = FMath::Abs(GetRecord(i).Time - Time);
+		if (Delta < BestDelta)
+		{
+			BestDelta = Delta;
+			Best = i;
+		}
+	}
+	return Best;
+}
+
+TArray<uint8> FInteractionFlightRecorder::SaveToBytes() const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Ar(Bytes);
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	int32 NumRecords = Count;
+	Ar << Magic << Version << NumRecords;
+
+	// Resolve names of the actors still alive so the dump is readable offline.
+	TMap<uint32, FString> Names;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FInteractionFlightRecord& R = GetRecord(i);
+		for (const uint32 Id : { R.HitActorId, R.FocusedActorId })
+		{
+			if (Id == 0 || Names.Contains(Id)) continue;
+
+			const FUObjectItem* Item = GUObjectArray.IndexToObject(static_cast<int32>(Id));
+			const UObject* Object = Item ? static_cast<const UObject*>(Item->GetObject()) : nullptr;
+			Names.Add(Id, Object ? Object->GetName() : FString());
+		}
+	}
+	Ar << Names;
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FInteractionFlightRecord R = GetRecord(i);
+		Ar << R;
+	}
+
+	return Bytes;
+}
+
+bool FInteractionFlightRecorder::DumpToFile(const FString& FilePath) const
+{
+	if (!FFileHelper::SaveArrayToFile(SaveToBytes(), *FilePath))
+	{
+		UE_LOG(LogInteractionFramework, Warning, TEXT("Flight recorder: could not write '%s'."), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogInteractionFramework, Log, TEXT("Flight recorder: wrote %d records to '%s'."), Count, *FilePath);
+	return true;
+}
+
+void FInteractionFlightRecorder::DumpToFileAsync(const FString& FilePath) const
+{
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [FilePath, Bytes = SaveToBytes(), NumRecords = Count]()
+	{
+		if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+		{
+			UE_LOG(LogInteractionFramework, Warning, TEXT("Flight recorder: could not write '%s'."), *FilePath);
+			return;
+		}
+		UE_LOG(LogInteractionFramework, Log, TEXT("Flight recorder: wrote %d records to '%s'."), NumRecords, *FilePath);
+	});
+}
+
+bool FInteractionFlightRecorder::LoadFromBytes(const TArray<uint8>& Bytes)
+{
+	FMemoryReader Ar(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumRecords = 0;
+	Ar << Magic << Version << NumRecords;
+	if (Ar.IsError() || Magic != FileMagic || Version != FileVersion || NumRecords < 0) return false;
+
+	TMap<uint32, FString> Names;
+	Ar << Names;
+
+	TArray<FInteractionFlightRecord> Loaded;
+	Loaded.SetNum(NumRecords);
+	for (FInteractionFlightRecord& R : Loaded)
+	{
+		Ar << R;
+	}
+	if (Ar.IsError()) return false;
+
+	Initialize(NumRecords);
+	for (const FInteractionFlightRecord& R : Loaded)
+	{
+		Record(R);
+	}
+	ActorNames = MoveTemp(Names);
+	return true;
+}
+
+bool FInteractionFlightRecorder::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath) || !LoadFromBytes(Bytes))
+	{
+		UE_LOG(LogInteractionFramework, Warning, TEXT("Flight recorder: '%s' is not a readable flight recorder dump."), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogInteractionFramework, Log, TEXT("Flight recorder: loaded %d records from '%s'."), Count, *FilePath);
+	return true;
+}
+
+// Console viewer
+
+namespace InteractionFlightRecorderCommands
+{
+	void ForEachComponent(UWorld* World, TFunctionRef<void(UInteractionComponent&)> Func)
+	{
+		for (TObjectIterator<UInteractionComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->HasBegunPlay())
+			{
+				Func(**It);
+			}
+		}
+	}
+
+	FColor GetRecordColor(const FInteractionFlightRecord& R)
+	{
+		if (R.FocusedActorId != 0) return R.HasFlag(FInteractionFlightRecord::Available) ? FColor::Green : FColor::Orange;
+		if (R.HasFlag(FInteractionFlightRecord::TraceHit)) return FColor::Yellow;
+		return FColor::Cyan;
+	}
+
+	/** Recording loaded with Interaction.FlightRecorder.Load; replaces the live recorders in Replay and Scrub. */
+	FInteractionFlightRecorder LoadedRecorder;
+	FString LoadedFile;
+
+	/**
+	 * Calls Func with every recorder to view and the time "now" is for it: the loaded recording relative to its
+	 * newest record, or the live recorders of the world relative to the world time.
+	 */
+	void ForEachRecorder(UWorld* World, TFunctionRef<void(const FInteractionFlightRecorder&, const FString&, double)> Func)
+	{
+		if (!LoadedFile.IsEmpty())
+		{
+			if (LoadedRecorder.Num() > 0)
+			{
+				Func(LoadedRecorder, LoadedFile, LoadedRecorder.GetRecord(LoadedRecorder.Num() - 1).Time);
+			}
+			return;
+		}
+
+		const double Now = World->GetTimeSeconds();
+		ForEachComponent(World, [&](UInteractionComponent& Comp)
+		{
+			Func(Comp.GetFlightRecorder(), GetNameSafe(Comp.GetOwner()), Now);
+		});
+	}
+
+	FString GetActorLabel(const FInteractionFlightRecorder& Recorder, uint32 ActorId)
+	{
+		const FString* Name = Recorder.FindActorName(ActorId);
+		return Name && !Name->IsEmpty() ? FString::Printf(TEXT("%u (%s)"), ActorId, **Name) : FString::Printf(TEXT("%u"), ActorId);
+	}
+
+	void DrawRecord(UWorld* World, const FInteractionFlightRecord& R, float Lifetime)
+	{
+		const FColor Color = GetRecordColor(R);
+		DrawDebugLine(World, FVector(R.TraceStart), FVector(R.TraceEnd), Color, false, Lifetime, 0, 0.5f);
+		if (R.HasFlag(FInteractionFlightRecord::TraceHit))
+		{
+			DrawDebugPoint(World, FVector(R.ImpactPoint), 8.f, Color, false, Lifetime);
+		}
+	}
+
+	void LogRecord(const FInteractionFlightRecorder& Recorder, const FInteractionFlightRecord& R, double Now)
+	{
+		UE_LOG(LogInteractionFramework, Log,
+			TEXT("  t-%.2fs Hit=%s Focus=%s Prompt=%d Available=%d Unmet=%d Input=%d Holding=%d (%.2f) Enabled=%d"),
+			Now - R.Time, *GetActorLabel(Recorder, R.HitActorId), *GetActorLabel(Recorder, R.FocusedActorId),
+			R.HasFlag(FInteractionFlightRecord::PromptVisible), R.HasFlag(FInteractionFlightRecord::Available),
+			R.UnmetRequirements, R.InputType,
+			R.HasFlag(FInteractionFlightRecord::Holding), R.HoldProgress,
+			R.HasFlag(FInteractionFlightRecord::Enabled));
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs DumpCommand(
+		TEXT("Interaction.FlightRecorder.Dump"),
+		TEXT("Writes the flight recorder of every interaction component to Saved/Interaction."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			ForEachComponent(World, [](UInteractionComponent& Comp)
+			{
+				Comp.DumpFlightRecorder(TEXT("Manual"));
+			});
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs LoadCommand(
+		TEXT("Interaction.FlightRecorder.Load"),
+		TEXT("Loads a dump for Replay and Scrub instead of the live recorders. Relative paths are looked up in Saved/Interaction. Usage: Interaction.FlightRecorder.Load <File.ifr>"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (Args.Num() == 0) return;
+
+			FString Path = Args[0];
+			if (FPaths::IsRelative(Path) && !FPaths::FileExists(Path))
+			{
+				Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Interaction"), Path);
+			}
+
+			if (LoadedRecorder.LoadFromFile(Path))
+			{
+				LoadedFile = FPaths::GetCleanFilename(Path);
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs UnloadCommand(
+		TEXT("Interaction.FlightRecorder.Unload"),
+		TEXT("Drops the loaded dump; Replay and Scrub go back to the live recorders."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			LoadedRecorder = FInteractionFlightRecorder();
+			LoadedFile.Reset();
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs ReplayCommand(
+		TEXT("Interaction.FlightRecorder.Replay"),
+		TEXT("Redraws every recorded trace of the last N seconds (of the loaded dump, if any). Usage: Interaction.FlightRecorder.Replay <Seconds> [DrawTime=10]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World) return;
+
+			const double Seconds = Args.Num() > 0 ? FCString::Atod(*Args[0]) : 5.0;
+			const float DrawTime = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 10.f;
+
+			ForEachRecorder(World, [&](const FInteractionFlightRecorder& Recorder, const FString& Label, double Now)
+			{
+				for (int32 i = 0; i < Recorder.Num(); ++i)
+				{
+					const FInteractionFlightRecord& R = Recorder.GetRecord(i);
+					if (Now - R.Time <= Seconds)
+					{
+						DrawRecord(World, R, DrawTime);
+					}
+				}
+			});
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs ScrubCommand(
+		TEXT("Interaction.FlightRecorder.Scrub"),
+		TEXT("Draws and logs the records around a point in the past (of the loaded dump, if any). Usage: Interaction.FlightRecorder.Scrub <SecondsAgo> [Window=0.5]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World) return;
+
+			const double SecondsAgo = Args.Num() > 0 ? FCString::Atod(*Args[0]) : 1.0;
+			const double Window = Args.Num() > 1 ? FCString::Atod(*Args[1]) : 0.5;
+
+			ForEachRecorder(World, [&](const FInteractionFlightRecorder& Recorder, const FString& Label, double Now)
+			{
+				const double Center = Now - SecondsAgo;
+				const int32 Closest = Recorder.FindClosestRecord(Center);
+				if (Closest == INDEX_NONE) return;
+
+				UE_LOG(LogInteractionFramework, Log, TEXT("Flight recorder '%s' around t-%.2fs:"), *Label, SecondsAgo);
+				for (int32 i = 0; i < Recorder.Num(); ++i)
+				{
+					const FInteractionFlightRecord& R = Recorder.GetRecord(i);
+					if (FMath::Abs(R.Time - Center) <= Window * 0.5)
+					{
+						DrawRecord(World, R, 5.f);
+						LogRecord(Recorder, R, Now);
+					}
+				}
+
+				// Highlight the closest record
+				const FInteractionFlightRecord& R = Recorder.GetRecord(Closest);
+				DrawDebugLine(World, FVector(R.TraceStart), FVector(R.TraceEnd), FColor::White, false, 5.f, 0, 2.f);
+			});
+		}));
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One compact record of an interactor's scan state.
+ * Actors are stored as UObject UniqueIDs; names are resolved only when dumping.
+ */
+struct FInteractionFlightRecord
+{
+	enum EFlags : uint8
+	{
+		TraceHit        = 1 << 0,
+		HitInteractable = 1 << 1,
+		PromptVisible   = 1 << 2,
+		Available       = 1 << 3,
+		Holding         = 1 << 4,
+		Enabled         = 1 << 5,
+	};
+
+	double Time = 0.0;
+	FVector3f TraceStart = FVector3f::ZeroVector;
+	FVector3f TraceEnd = FVector3f::ZeroVector;
+	FVector3f ImpactPoint = FVector3f::ZeroVector;
+	uint32 HitActorId = 0;
+	uint32 FocusedActorId = 0;
+	float HoldProgress = 0.f;
+	int16 UnmetRequirements = 0;
+	uint8 InputType = 0;
+	uint8 Flags = 0;
+
+	bool HasFlag(EFlags Flag) const { return (Flags & Flag) != 0; }
+
+	friend FArchive& operator<<(FArchive& Ar, FInteractionFlightRecord& R)
+	{
+		Ar << R.Time << R.TraceStart << R.TraceEnd << R.ImpactPoint;
+		Ar << R.HitActorId << R.FocusedActorId << R.HoldProgress;
+		Ar << R.UnmetRequirements << R.InputType << R.Flags;
+		return Ar;
+	}
+};
+
+/**
+ * FInteractionFlightRecorder
+ *
+ * Fixed-size ring buffer of the most recent scan records of one interactor.
+ * Storage is allocated once in Initialize, recording never allocates.
+ *
+ * Dumps are written as: magic, version, record count, name table (UniqueID -> name), records oldest first.
+ * A dump can be loaded back into a recorder, so the console viewer can replay recordings from other sessions.
+ */
+class INTERACTIONFRAMEWORK_API FInteractionFlightRecorder
+{
+public:
+	static constexpr uint32 FileMagic = 0x31524649; // "IFR1"
+	static constexpr uint32 FileVersion = 1;
+
+	void Initialize(int32 InCapacity);
+	void Reset();
+
+	void Record(const FInteractionFlightRecord& InRecord);
+
+	int32 Num() const { return Count; }
+	int32 GetCapacity() const { return Records.Num(); }
+
+	/** Index 0 is the oldest record still in the buffer. */
+	const FInteractionFlightRecord& GetRecord(int32 Index) const;
+
+	/** Finds the record closest to the given time, INDEX_NONE if empty. */
+	int32 FindClosestRecord(double Time) const;
+
+	/** The bytes of a dump. Actor names are resolved here, on the calling thread. */
+	TArray<uint8> SaveToBytes() const;
+	bool DumpToFile(const FString& FilePath) const;
+
+	/** Builds the dump on the calling thread and writes it from a background task. */
+	void DumpToFileAsync(const FString& FilePath) const;
+
+	/** Replaces the buffer with the records of a dump; the capacity becomes the dump's record count. */
+	bool LoadFromBytes(const TArray<uint8>& Bytes);
+	bool LoadFromFile(const FString& FilePath);
+
+	/** Actor name stored in a loaded dump, null for live recorders and actors that were gone when dumping. */
+	const FString* FindActorName(uint32 ActorId) const { return ActorNames.Find(ActorId); }
+
+private:
+	TArray<FInteractionFlightRecord> Records;
+	TMap<uint32, FString> ActorNames;
+	int32 Head = 0;  // Next write position
+	int32 Count = 0;
+};
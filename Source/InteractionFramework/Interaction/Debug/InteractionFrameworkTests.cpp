@@ -1,9 +1,12 @@
 ﻿#if WITH_AUTOMATION_TESTS
 
 #include "Interaction/InteractionUtils.h"
+#include "Interaction/InteractableComponent.h"
+#include "Interaction/InteractableActorBase.h"
 #include "Misc/AutomationTest.h"
 #include "Interaction/KeyringComponent.h"
 #include "Interaction/Data/InteractionDataAsset.h"
+#include "Interaction/Debug/InteractionFlightRecorder.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKeyring_AddRemove,
 	"InteractionFramework.Keyring.AddRemove",
@@ -106,4 +109,163 @@ bool FRequirements_MissingMessages::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueryResult_ChangeDiff,
+	"InteractionFramework.QueryResult.ChangeDiff",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQueryResult_ChangeDiff::RunTest(const FString& Parameters)
+{
+	const FText Open = FText::FromString("Open");
+	const TArray<FText> Missing = { FText::FromString("Missing Red") };
+
+	const FInteractionQueryResult Base = FInteractionQueryResult::Make(true, Open, EInteractionInputType::Press, 0.f, Missing, 1);
+
+	TestEqual(TEXT("Identical results should have no changes"),
+		Base.GetChangesFrom(Base), EInteractionQueryChange::None);
+
+	// Same text content built from a different FText instance is not a change
+	const FInteractionQueryResult SameText = FInteractionQueryResult::Make(true, FText::FromString("Open"), EInteractionInputType::Press, 0.f, Missing, 1);
+	TestEqual(TEXT("Equal prompt strings should not be a change"),
+		SameText.GetChangesFrom(Base), EInteractionQueryChange::None);
+
+	const FInteractionQueryResult Hidden = FInteractionQueryResult::Make(false, Open, EInteractionInputType::Press, 0.f, Missing, 1);
+	TestEqual(TEXT("Visibility only"),
+		Hidden.GetChangesFrom(Base), EInteractionQueryChange::Visibility);
+
+	const FInteractionQueryResult Close = FInteractionQueryResult::Make(true, FText::FromString("Close"), EInteractionInputType::Press, 0.f, Missing, 1);
+	TestEqual(TEXT("Prompt text only"),
+		Close.GetChangesFrom(Base), EInteractionQueryChange::PromptText);
+
+	const FInteractionQueryResult Hold = FInteractionQueryResult::Make(true, Open, EInteractionInputType::Hold, 1.5f, Missing, 1);
+	TestEqual(TEXT("Input type only"),
+		Hold.GetChangesFrom(Base), EInteractionQueryChange::InputType);
+
+	const FInteractionQueryResult Met = FInteractionQueryResult::Make(true, Open);
+	TestEqual(TEXT("Requirements only"),
+		Met.GetChangesFrom(Base), EInteractionQueryChange::Requirements);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlightRecorder_RingBuffer,
+	"InteractionFramework.Debug.FlightRecorderRingBuffer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFlightRecorder_RingBuffer::RunTest(const FString& Parameters)
+{
+	FInteractionFlightRecorder Recorder;
+	Recorder.Initialize(4);
+
+	TestEqual(TEXT("Capacity should match Initialize"), Recorder.GetCapacity(), 4);
+	TestEqual(TEXT("New recorder should be empty"), Recorder.Num(), 0);
+	TestEqual(TEXT("Closest record of an empty recorder is none"), Recorder.FindClosestRecord(1.0), (int32)INDEX_NONE);
+
+	for (int32 i = 0; i < 6; ++i)
+	{
+		FInteractionFlightRecord R;
+		R.Time = i;
+		Recorder.Record(R);
+	}
+
+	// Oldest two records were overwritten
+	TestEqual(TEXT("Count should be capped at capacity"), Recorder.Num(), 4);
+	TestEqual(TEXT("Oldest record should be t=2"), Recorder.GetRecord(0).Time, 2.0);
+	TestEqual(TEXT("Newest record should be t=5"), Recorder.GetRecord(3).Time, 5.0);
+	TestEqual(TEXT("Closest record to t=3.9 should be t=4"), Recorder.GetRecord(Recorder.FindClosestRecord(3.9)).Time, 4.0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlightRecorder_DumpRoundTrip,
+	"InteractionFramework.Debug.FlightRecorderDumpRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFlightRecorder_DumpRoundTrip::RunTest(const FString& Parameters)
+{
+	FInteractionFlightRecorder Recorder;
+	Recorder.Initialize(4);
+
+	for (int32 i = 0; i < 6; ++i)
+	{
+		FInteractionFlightRecord R;
+		R.Time = i;
+		R.HoldProgress = i * 0.1f;
+		R.Flags = FInteractionFlightRecord::TraceHit;
+		Recorder.Record(R);
+	}
+
+	FInteractionFlightRecorder Loaded;
+	TestTrue(TEXT("Dump should load"), Loaded.LoadFromBytes(Recorder.SaveToBytes()));
+	TestEqual(TEXT("Loaded record count should match"), Loaded.Num(), 4);
+	TestEqual(TEXT("Oldest loaded record should be t=2"), Loaded.GetRecord(0).Time, 2.0);
+	TestEqual(TEXT("Newest loaded record should be t=5"), Loaded.GetRecord(3).Time, 5.0);
+	TestEqual(TEXT("Fields should survive the round trip"), Loaded.GetRecord(3).HoldProgress, 0.5f);
+	TestTrue(TEXT("Flags should survive the round trip"), Loaded.GetRecord(3).HasFlag(FInteractionFlightRecord::TraceHit));
+
+	TArray<uint8> Garbage = { 1, 2, 3, 4 };
+	TestFalse(TEXT("Bytes without the magic should not load"), Loaded.LoadFromBytes(Garbage));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractableComponent_StateAndRequirements,
+	"InteractionFramework.InteractableComponent.StateAndRequirements",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractableComponent_StateAndRequirements::RunTest(const FString& Parameters)
+{
+	UInteractionDataAsset* DA = NewObject<UInteractionDataAsset>(GetTransientPackage());
+
+	FInteractionStateDefinition Locked;
+	Locked.StateId = "Locked";
+	FInteractionKeyRequirement Req;
+	Req.KeyId = "Key";
+	Locked.RequiredKeys = { Req };
+
+	FInteractionStateDefinition Open;
+	Open.StateId = "Open";
+
+	DA->States = { Locked, Open };
+
+	UInteractableComponent* Comp = NewObject<UInteractableComponent>(GetTransientPackage());
+	Comp->InteractionData = DA;
+
+	TestTrue(TEXT("SetInteractionState(Locked) should succeed"), Comp->SetInteractionState("Locked"));
+	TestEqual(TEXT("State id should be Locked"), Comp->GetInteractionStateId(), FName("Locked"));
+	TestFalse(TEXT("Unknown state should be rejected"), Comp->SetInteractionState("DoesNotExist"));
+	TestEqual(TEXT("State should be unchanged after a rejected set"), Comp->GetInteractionStateId(), FName("Locked"));
+
+	TArray<FText> Missing;
+	TestTrue(TEXT("Locked without a keyring should be missing its key"), Comp->GetMissingRequirementMessages(nullptr, Missing));
+	TestEqual(TEXT("One requirement should be missing"), Missing.Num(), 1);
+	TestEqual(TEXT("Counting helper should agree"), InteractionUtils::CountMissingRequirements(Locked.RequiredKeys, nullptr), 1);
+
+	TestTrue(TEXT("SetInteractionState(Open) should succeed"), Comp->SetInteractionState("Open"));
+	TestFalse(TEXT("Open has no requirements"), Comp->GetMissingRequirementMessages(nullptr, Missing));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractableComponent_Footprint,
+	"InteractionFramework.InteractableComponent.Footprint",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInteractableComponent_Footprint::RunTest(const FString& Parameters)
+{
+	// Bytes the component adds on top of a bare actor component; it is placed on many level actors so keep it small.
+	constexpr int32 FootprintBudget = 64;
+
+	const int32 ComponentSize = UInteractableComponent::StaticClass()->GetStructureSize();
+	const int32 Footprint = ComponentSize - UActorComponent::StaticClass()->GetStructureSize();
+	const int32 ActorBaseSize = AInteractableActorBase::StaticClass()->GetStructureSize();
+
+	AddInfo(FString::Printf(TEXT("UInteractableComponent: %d bytes (%d over UActorComponent), AInteractableActorBase: %d bytes"),
+		ComponentSize, Footprint, ActorBaseSize));
+
+	TestTrue(FString::Printf(TEXT("Footprint %d should be within %d bytes"), Footprint, FootprintBudget), Footprint <= FootprintBudget);
+	TestTrue(TEXT("Component should be smaller than the interactable actor base"), ComponentSize < ActorBaseSize);
+
+	return true;
+}
+
 #endif
@@ -0,0 +1,187 @@
+#if WITH_AUTOMATION_TESTS
+
+#include "Interaction/Debug/InteractionBenchmark.h"
+#include "Interaction/InteractionUtils.h"
+#include "Interaction/KeyringComponent.h"
+#include "Dom/JsonObject.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+namespace InteractionKeyringBenchmark
+{
+	constexpr int32 NumQueries = 4096;
+	constexpr int32 NumRequirementSets = 512;
+	constexpr int32 Repeats = 16;
+	constexpr int32 RequirementCounts[] = { 1, 4, 16 };
+
+	FName GetMissingKeyId(int32 Index)
+	{
+		return FName(TEXT("BenchmarkMissingKey"), Index + 1);
+	}
+
+	/** Owned key with probability HitRatio, otherwise a key the keyring never had. */
+	FName PickKey(FRandomStream& Random, int32 KeyringSize, float HitRatio, int32 MissIndex)
+	{
+		return Random.FRand() < HitRatio
+			? InteractionBenchmark::GetKeyId(Random.RandHelper(KeyringSize))
+			: GetMissingKeyId(MissIndex);
+	}
+
+	/**
+	 * Requirement sets of RequirementCount keys. A HitRatio share of the sets is fully owned;
+	 * the rest miss their last key, so HasAllKeys has to check every entry before failing.
+	 */
+	TArray<TArray<FName>> MakeRequirementSets(FRandomStream& Random, int32 KeyringSize, int32 RequirementCount, float HitRatio)
+	{
+		TArray<TArray<FName>> Sets;
+		Sets.SetNum(NumRequirementSets);
+
+		for (int32 SetIndex = 0; SetIndex < NumRequirementSets; ++SetIndex)
+		{
+			const bool bMet = Random.FRand() < HitRatio;
+			TArray<FName>& Set = Sets[SetIndex];
+			for (int32 i = 0; i < RequirementCount; ++i)
+			{
+				const bool bMissing = !bMet && i == RequirementCount - 1;
+				Set.Add(bMissing ? GetMissingKeyId(SetIndex) : InteractionBenchmark::GetKeyId(Random.RandHelper(KeyringSize)));
+			}
+		}
+
+		return Sets;
+	}
+
+	TArray<FInteractionKeyRequirement> MakeRequirements(const TArray<FName>& Keys)
+	{
+		TArray<FInteractionKeyRequirement> Requirements;
+		for (const FName Key : Keys)
+		{
+			FInteractionKeyRequirement& Requirement = Requirements.AddDefaulted_GetRef();
+			Requirement.KeyId = Key;
+			Requirement.MissingMessage = FText::FromName(Key);
+		}
+		return Requirements;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FInteractionKeyringBenchmark,
+	"InteractionFramework.Benchmark.Keyring",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FInteractionKeyringBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 Size : { 1, 10, 100, 1000, 10000 })
+	{
+		for (const int32 HitPercent : { 0, 50, 100 })
+		{
+			OutBeautifiedNames.Add(FString::Printf(TEXT("%d Keys %d%% Hits"), Size, HitPercent));
+			OutTestCommands.Add(FString::Printf(TEXT("%d %d"), Size, HitPercent));
+		}
+	}
+}
+
+bool FInteractionKeyringBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace InteractionKeyringBenchmark;
+
+	FString SizeString;
+	FString HitString;
+	if (!TestTrue(TEXT("Parameters should be '<KeyringSize> <HitPercent>'"), Parameters.Split(TEXT(" "), &SizeString, &HitString))) return false;
+
+	const int32 KeyringSize = FMath::Max(1, FCString::Atoi(*SizeString));
+	const int32 HitPercent = FMath::Clamp(FCString::Atoi(*HitString), 0, 100);
+	const float HitRatio = HitPercent / 100.f;
+
+	UKeyringComponent* Keyring = NewObject<UKeyringComponent>(GetTransientPackage());
+	for (int32 i = 0; i < KeyringSize; ++i)
+	{
+		Keyring->AddKey(InteractionBenchmark::GetKeyId(i));
+	}
+
+	FRandomStream Random(KeyringSize * 101 + HitPercent);
+
+	TArray<FName> Queries;
+	TArray<FName> MissingQueries;
+	Queries.Reserve(NumQueries);
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		const FName Key = PickKey(Random, KeyringSize, HitRatio, i);
+		Queries.Add(Key);
+		if (!Keyring->HasKey(Key))
+		{
+			MissingQueries.Add(Key);
+		}
+	}
+
+	const TSharedRef<FJsonObject> Ops = MakeShared<FJsonObject>();
+	int32 Sink = 0;
+
+	const FInteractionMicroBenchmarkResult HasKey = InteractionBenchmark::MeasureOps(NumQueries, Repeats,
+		[&](int32 i) { Sink += Keyring->HasKey(Queries[i]); },
+		[] {});
+	Ops->SetObjectField(TEXT("has_key"), HasKey.ToJson());
+
+	// Hits are no-ops, misses insert; the untimed reset removes them again.
+	const FInteractionMicroBenchmarkResult AddKey = InteractionBenchmark::MeasureOps(NumQueries, Repeats,
+		[&](int32 i) { Sink += Keyring->AddKey(Queries[i]); },
+		[&] { for (const FName Key : MissingQueries) { Keyring->RemoveKey(Key); } });
+	Ops->SetObjectField(TEXT("add_key"), AddKey.ToJson());
+
+	const FInteractionMicroBenchmarkResult RemoveKey = InteractionBenchmark::MeasureOps(MissingQueries.Num(), Repeats,
+		[&](int32 i) { Sink += Keyring->RemoveKey(MissingQueries[i]); },
+		[&] { for (const FName Key : MissingQueries) { Keyring->AddKey(Key); } });
+	Ops->SetObjectField(TEXT("remove_key"), RemoveKey.ToJson());
+
+	// Leave the keyring at its original size for the requirement benchmarks.
+	for (const FName Key : MissingQueries)
+	{
+		Keyring->RemoveKey(Key);
+	}
+
+	FString Summary = FString::Printf(TEXT("Keys=%d Hits=%d%% | HasKey %.1fns | AddKey %.1fns %.2f allocs | RemoveKey %.1fns"),
+		KeyringSize, HitPercent, HasKey.NsPerOp, AddKey.NsPerOp, AddKey.AllocsPerOp, RemoveKey.NsPerOp);
+
+	for (const int32 RequirementCount : RequirementCounts)
+	{
+		const TArray<TArray<FName>> Sets = MakeRequirementSets(Random, KeyringSize, RequirementCount, HitRatio);
+
+		TArray<TArray<FInteractionKeyRequirement>> Requirements;
+		for (const TArray<FName>& Set : Sets)
+		{
+			Requirements.Add(MakeRequirements(Set));
+		}
+
+		const FInteractionMicroBenchmarkResult HasAllKeys = InteractionBenchmark::MeasureOps(Sets.Num(), Repeats,
+			[&](int32 i) { Sink += Keyring->HasAllKeys(Sets[i]); },
+			[] {});
+
+		// A fresh output array per call, as interactables do when answering a query.
+		const FInteractionMicroBenchmarkResult BuildMissing = InteractionBenchmark::MeasureOps(Requirements.Num(), Repeats,
+			[&](int32 i)
+			{
+				TArray<FText> Missing;
+				Sink += InteractionUtils::BuildMissingMessages(Requirements[i], Keyring, Missing);
+			},
+			[] {});
+
+		Ops->SetObjectField(FString::Printf(TEXT("has_all_keys_r%d"), RequirementCount), HasAllKeys.ToJson());
+		Ops->SetObjectField(FString::Printf(TEXT("build_missing_messages_r%d"), RequirementCount), BuildMissing.ToJson());
+
+		Summary += FString::Printf(TEXT(" | R=%d HasAllKeys %.1fns BuildMissingMessages %.1fns %.2f allocs"),
+			RequirementCount, HasAllKeys.NsPerOp, BuildMissing.NsPerOp, BuildMissing.AllocsPerOp);
+	}
+
+	AddInfo(Summary);
+
+	const TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	Results->SetNumberField(TEXT("keyring_size"), KeyringSize);
+	Results->SetNumberField(TEXT("hit_ratio"), HitRatio);
+	Results->SetObjectField(TEXT("ops"), Ops);
+	Results->SetNumberField(TEXT("sink"), Sink);
+
+	const FString Path = InteractionBenchmark::WriteResults(FString::Printf(TEXT("KeyringBenchmark_%d_%d"), KeyringSize, HitPercent), Results);
+	TestFalse(TEXT("Benchmark results should be written"), Path.IsEmpty());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,256 @@
+#if WITH_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+#include "Interaction/Debug/InteractionBenchmark.h"
+#include "Interaction/Debug/InteractionBenchmarkActor.h"
+#include "Interaction/InteractionComponent.h"
+#include "Interaction/InteractionRegistrySubsystem.h"
+#include "Interaction/Mass/InteractionMassProcessor.h"
+#include "Interaction/Mass/InteractionMassSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "MassEntitySubsystem.h"
+#include "MassExecutor.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectArray.h"
+
+namespace InteractionMassStressTest
+{
+	constexpr int32 MeasuredPasses = 10;
+
+	/** Agents scattered over the interactable grid, facing random directions. Same for both paths. */
+	struct FAgentStart
+	{
+		FVector Location;
+		float Yaw;
+	};
+
+	TArray<FAgentStart> MakeAgentStarts(const FInteractionCrowdScenario& Scenario, int32 NumAgents, float HalfExtent)
+	{
+		FRandomStream Random(NumAgents);
+		TArray<FAgentStart> Starts;
+		Starts.Reserve(NumAgents);
+		for (int32 i = 0; i < NumAgents; ++i)
+		{
+			const FVector Location = Scenario.MakeAgentLocation(Random, HalfExtent);
+			Starts.Add({ Location, Random.FRandRange(0.f, 360.f) });
+		}
+		return Starts;
+	}
+
+	/** Spawns the grid and initializes it right away: both paths only consider initialized interactables. */
+	void SetUpWorld(const FInteractionCrowdScenario& Scenario, FInteractionBenchmarkWorld& BenchWorld)
+	{
+		Scenario.SpawnInteractables(BenchWorld);
+		for (AInteractionBenchmarkActor* Interactable : BenchWorld.GetInteractables())
+		{
+			UInteractionRegistrySubsystem::EnsureInitialized(Interactable);
+		}
+	}
+
+	TSharedRef<FJsonObject> MakePathResults(const FInteractionBenchmarkSamples& Passes, int32 NumAgents, int64 Interacts, int64 NetBytes, int32 ObjectsPerAgent)
+	{
+		const double Seconds = Passes.GetMean() * Passes.Num() / 1.0e6;
+
+		const TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+		Results->SetObjectField(TEXT("pass"), Passes.ToJson());
+		Results->SetNumberField(TEXT("agents_per_second"), Seconds > 0.0 ? static_cast<double>(NumAgents) * Passes.Num() / Seconds : 0.0);
+		Results->SetNumberField(TEXT("interacts_per_second"), Seconds > 0.0 ? static_cast<double>(Interacts) / Seconds : 0.0);
+		Results->SetNumberField(TEXT("interacts"), static_cast<double>(Interacts));
+		Results->SetNumberField(TEXT("bytes_per_agent"), static_cast<double>(NetBytes) / NumAgents);
+		Results->SetNumberField(TEXT("uobjects_per_agent"), ObjectsPerAgent);
+		return Results;
+	}
+}
+
+/**
+ * Compares interaction throughput of crowd interactors on the actor-component path (an actor with
+ * UInteractionComponent + UKeyringComponent per agent) and on the Mass path (entities processed by
+ * UInteractionMassProcessor) among 2000 interactables.
+ *
+ * Every pass, each agent selects its focus and interacts with it: PerformFocusScan + ExecutePress per component,
+ * versus one candidate rebuild, one processor run and the queued interacts for the entities.
+ * Each path runs in a fresh world, so both start from interactables in their default states.
+ * Reports pass time, agents and interacts per second and memory per agent for both paths.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FInteractionMassStressTest,
+	"InteractionFramework.Stress.MassInteractors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::StressFilter)
+
+void FInteractionMassStressTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 Agents : { 1000, 10000, 50000 })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Agents"), Agents));
+		OutTestCommands.Add(FString::FromInt(Agents));
+	}
+}
+
+bool FInteractionMassStressTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionMassStressTest;
+
+	const int32 NumAgents = FCString::Atoi(*Parameters);
+	if (!TestTrue(TEXT("Agent count should be positive"), NumAgents > 0)) return false;
+
+	const FInteractionCrowdScenario Scenario;
+	const TArray<FName> AgentKeys = { InteractionBenchmark::GetKeyId(0), InteractionBenchmark::GetKeyId(1) };
+
+	// Actor-component path
+	TSharedPtr<FJsonObject> ComponentResults;
+	{
+		FInteractionBenchmarkWorld BenchWorld;
+		SetUpWorld(Scenario, BenchWorld);
+		const TArray<FAgentStart> Starts = MakeAgentStarts(Scenario, NumAgents, BenchWorld.GetGridHalfExtent());
+
+		const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+		TArray<UInteractionComponent*> Interactors;
+		Interactors.Reserve(NumAgents);
+
+		FInteractionAllocationCounter Allocations;
+		Allocations.Start();
+		for (const FAgentStart& Start : Starts)
+		{
+			if (UInteractionComponent* Comp = BenchWorld.SpawnInteractor(Start.Location, /*bFlightRecorder*/ false))
+			{
+				Comp->GetOwner()->SetActorRotation(FRotator(0.f, Start.Yaw, 0.f));
+				Interactors.Add(Comp);
+			}
+		}
+		Allocations.Stop();
+
+		if (!TestEqual(TEXT("All component interactors should spawn"), Interactors.Num(), NumAgents)) return false;
+
+		const int32 ObjectsPerAgent = (GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore) / NumAgents;
+
+		FInteractionBenchmarkSamples Passes;
+		Passes.Reserve(MeasuredPasses);
+		int64 Interacts = 0;
+
+		for (int32 Pass = 0; Pass < MeasuredPasses; ++Pass)
+		{
+			FInteractionBenchmarkScope Scope(Passes);
+			for (UInteractionComponent* Comp : Interactors)
+			{
+				FInteractionBenchmarkAccess::PerformFocusScan(*Comp);
+				if (Comp->GetFocusedActor() && Comp->GetCachedQueryResult().UnmetRequirementNumber == 0)
+				{
+					FInteractionBenchmarkAccess::ExecutePress(*Comp);
+					++Interacts;
+				}
+			}
+		}
+
+		TestTrue(TEXT("Component interactors should interact"), Interacts > 0);
+		ComponentResults = MakePathResults(Passes, NumAgents, Interacts, Allocations.GetNetBytes(), ObjectsPerAgent);
+
+		// The world, its actors and the states the passes left behind are freed before the Mass path is measured.
+		Interactors.Reset();
+	}
+
+	// Mass path
+	TSharedPtr<FJsonObject> MassResults;
+	{
+		FInteractionBenchmarkWorld BenchWorld;
+		UWorld* World = BenchWorld.GetWorld();
+		SetUpWorld(Scenario, BenchWorld);
+		const TArray<FAgentStart> Starts = MakeAgentStarts(Scenario, NumAgents, BenchWorld.GetGridHalfExtent());
+
+		UMassEntitySubsystem* EntitySubsystem = World->GetSubsystem<UMassEntitySubsystem>();
+		UInteractionMassSubsystem* Interaction = UInteractionMassSubsystem::Get(World);
+		if (!TestNotNull(TEXT("Mass entity subsystem"), EntitySubsystem) || !TestNotNull(TEXT("Interaction Mass subsystem"), Interaction)) return false;
+
+		FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+		const FInteractionKeyBits Keys = Interaction->MakeKeyBits(AgentKeys);
+
+		UInteractionMassProcessor* Processor = NewObject<UInteractionMassProcessor>(World);
+		Processor->CallInitialize(World, EntityManager.AsShared());
+
+		const FMassArchetypeHandle Archetype = EntityManager.CreateArchetype(TArray<const UScriptStruct*>{
+			FInteractionViewFragment::StaticStruct(),
+			FInteractionKeysFragment::StaticStruct(),
+			FInteractionFocusFragment::StaticStruct() });
+
+		TArray<FMassEntityHandle> Entities;
+
+		FInteractionAllocationCounter Allocations;
+		Allocations.Start();
+		{
+			TSharedRef<FMassEntityManager::FEntityCreationContext> Creation = EntityManager.BatchCreateEntities(Archetype, NumAgents, Entities);
+		}
+		Allocations.Stop();
+
+		if (!TestEqual(TEXT("All entities should be created"), Entities.Num(), NumAgents)) return false;
+
+		for (int32 i = 0; i < NumAgents; ++i)
+		{
+			FInteractionViewFragment& View = EntityManager.GetFragmentDataChecked<FInteractionViewFragment>(Entities[i]);
+			View.Location = Starts[i].Location;
+			View.Forward = FVector3f(FRotator(0.f, Starts[i].Yaw, 0.f).Vector());
+			EntityManager.GetFragmentDataChecked<FInteractionKeysFragment>(Entities[i]).Keys = Keys;
+		}
+
+		FInteractionBenchmarkSamples Passes;
+		Passes.Reserve(MeasuredPasses);
+		const int64 InteractsBefore = Interaction->GetNumInteracts();
+		int32 FocusedAgents = 0;
+
+		// Builds the candidates if the world has not ticked yet; passes then only apply the previous pass's changes, as Tick does.
+		Interaction->UpdateCandidates();
+
+		for (int32 Pass = 0; Pass < MeasuredPasses; ++Pass)
+		{
+			for (const FMassEntityHandle Entity : Entities)
+			{
+				EntityManager.GetFragmentDataChecked<FInteractionFocusFragment>(Entity).bWantsToInteract = true;
+			}
+
+			{
+				FInteractionBenchmarkScope Scope(Passes);
+				Interaction->UpdateCandidates();
+				FMassProcessingContext ProcessingContext(EntityManager, Scenario.FrameDeltaSeconds);
+				UE::Mass::Executor::Run(*Processor, ProcessingContext);
+				Interaction->ProcessRequests();
+			}
+		}
+
+		for (const FMassEntityHandle Entity : Entities)
+		{
+			FocusedAgents += EntityManager.GetFragmentDataChecked<FInteractionFocusFragment>(Entity).Target != FObjectKey() ? 1 : 0;
+		}
+
+		const int64 Interacts = Interaction->GetNumInteracts() - InteractsBefore;
+		TestTrue(TEXT("Mass agents should focus interactables"), FocusedAgents > 0);
+		TestTrue(TEXT("Mass agents should interact"), Interacts > 0);
+
+		MassResults = MakePathResults(Passes, NumAgents, Interacts, Allocations.GetNetBytes(), 0);
+		MassResults->SetNumberField(TEXT("focused_agent_ratio"), static_cast<double>(FocusedAgents) / NumAgents);
+
+		EntityManager.BatchDestroyEntities(Entities);
+	}
+
+	const double ComponentRate = ComponentResults->GetNumberField(TEXT("agents_per_second"));
+	const double MassRate = MassResults->GetNumberField(TEXT("agents_per_second"));
+
+	const TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	Results->SetNumberField(TEXT("agents"), NumAgents);
+	Results->SetNumberField(TEXT("interactables"), Scenario.NumInteractables);
+	Results->SetNumberField(TEXT("passes"), MeasuredPasses);
+	Results->SetObjectField(TEXT("component"), ComponentResults);
+	Results->SetObjectField(TEXT("mass"), MassResults);
+	Results->SetNumberField(TEXT("mass_speedup"), ComponentRate > 0.0 ? MassRate / ComponentRate : 0.0);
+
+	AddInfo(FString::Printf(TEXT("Agents=%d | component %.0f agents/s, %.0f bytes/agent | mass %.0f agents/s, %.0f bytes/agent | speedup %.1fx"),
+		NumAgents,
+		ComponentRate, ComponentResults->GetNumberField(TEXT("bytes_per_agent")),
+		MassRate, MassResults->GetNumberField(TEXT("bytes_per_agent")),
+		ComponentRate > 0.0 ? MassRate / ComponentRate : 0.0));
+
+	const FString Path = InteractionBenchmark::WriteResults(FString::Printf(TEXT("MassStress_%d"), NumAgents), Results);
+	TestFalse(TEXT("Stress results should be written"), Path.IsEmpty());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,402 @@
+#include "InteractionSoakBotController.h"
+#include "InteractionStressPawn.h"
+#include "Interaction/Interactable.h"
+#include "Interaction/InteractionComponent.h"
+#include "Interaction/InteractionRegistrySubsystem.h"
+#include "Interaction/InteractionUtils.h"
+#include "InteractionFramework.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectIterator.h"
+
+AInteractionSoakBotController::AInteractionSoakBotController()
+{
+	PrimaryActorTick.bCanEverTick = true;
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace InteractionSoakBot
+{
+	/** Items have no bounds of their own; the pawn stands this far in front of them. */
+	constexpr float ItemStandoff = 150.f;
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GSoakBotStartCommand(
+	TEXT("Interaction.SoakBot.Start"),
+	TEXT("Interaction.SoakBot.Start [Hours] - Spawns a bot that interacts with every interactable in the world until stopped or Hours have passed."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const float Hours = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 0.f;
+		AInteractionSoakBotController::StartSoak(World, Hours);
+	}));
+
+static FAutoConsoleCommandWithWorld GSoakBotStopCommand(
+	TEXT("Interaction.SoakBot.Stop"),
+	TEXT("Stops all soak bots in the world and logs their final report."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&AInteractionSoakBotController::StopSoak));
+
+AInteractionSoakBotController* AInteractionSoakBotController::StartSoak(UWorld* World, float Hours)
+{
+	if (!World) return nullptr;
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Params.bDeferConstruction = true;
+
+	AInteractionStressPawn* Pawn = World->SpawnActor<AInteractionStressPawn>(AInteractionStressPawn::StaticClass(), FTransform::Identity, Params);
+	if (!Pawn) return nullptr;
+
+	Pawn->bWanderEnabled = false;
+	Pawn->AutoPossessAI = EAutoPossessAI::Disabled;
+	Pawn->FinishSpawning(FTransform::Identity);
+
+	AInteractionSoakBotController* Bot = World->SpawnActor<AInteractionSoakBotController>();
+	if (!Bot)
+	{
+		Pawn->Destroy();
+		return nullptr;
+	}
+
+	Bot->Possess(Pawn);
+	Bot->BeginRun(Hours);
+	return Bot;
+}
+
+void AInteractionSoakBotController::StopSoak(UWorld* World)
+{
+	if (!World) return;
+
+	for (TActorIterator<AInteractionSoakBotController> It(World); It; ++It)
+	{
+		It->Report(TEXT("Stopped"));
+		if (APawn* Pawn = It->GetPawn())
+		{
+			Pawn->Destroy();
+		}
+		It->Destroy();
+	}
+}
+
+void AInteractionSoakBotController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+	InteractionComp = InPawn ? InPawn->FindComponentByClass<UInteractionComponent>() : nullptr;
+
+	if (!InteractionComp.IsValid())
+	{
+		UE_LOG(LogInteractionFramework, Error, TEXT("[SoakBot] Possessed pawn %s has no interaction component."), *GetNameSafe(InPawn));
+	}
+}
+
+void AInteractionSoakBotController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractionComponent* Comp = InteractionComp.Get())
+	{
+		Comp->EndInteract();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AInteractionSoakBotController::BeginRun(float Hours)
+{
+	StartRealTime = FPlatformTime::Seconds();
+	LastFrameRealTime = StartRealTime;
+	NextReportRealTime = StartRealTime + ReportInterval;
+	RunEndRealTime = Hours > 0.f ? StartRealTime + Hours * 3600.0 : 0.0;
+	StartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	StartObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+	GatherTargets();
+	SetPhase(EPhase::NextTarget);
+
+	UE_LOG(LogInteractionFramework, Display, TEXT("[SoakBot] Started with %d interactables%s."),
+		Targets.Num(), Hours > 0.f ? *FString::Printf(TEXT(" for %.2f hours"), Hours) : TEXT(" until stopped"));
+}
+
+void AInteractionSoakBotController::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	TrackFrameTime();
+	if (IsActorBeingDestroyed()) return;
+
+	UInteractionComponent* Comp = InteractionComp.Get();
+	if (!Comp || !GetPawn()) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	UObject* Target = GetCurrentTarget();
+
+	if (Phase != EPhase::NextTarget && !Target)
+	{
+		// Destroyed while we were on it (e.g. a consumed pickup).
+		Comp->EndInteract();
+		SetPhase(EPhase::NextTarget);
+		return;
+	}
+
+	switch (Phase)
+	{
+	case EPhase::NextTarget:
+		AdvanceTarget();
+		break;
+
+	case EPhase::AcquireFocus:
+		if (IsTargetFocused())
+		{
+			SetPhase(EPhase::Interact);
+		}
+		else if (Now - PhaseStartTime > FocusTimeout)
+		{
+			UE_LOG(LogInteractionFramework, Verbose, TEXT("[SoakBot] Could not focus %s, skipping."), *GetNameSafe(Target));
+			++TargetsSkipped;
+			SetPhase(EPhase::NextTarget);
+		}
+		break;
+
+	case EPhase::Interact:
+	{
+		if (!IsTargetFocused())
+		{
+			PlacePawnInFrontOf(Targets[TargetIndex]);
+			SetPhase(EPhase::AcquireFocus);
+			break;
+		}
+
+		if (InteractionsDone >= InteractionsPerState)
+		{
+			AdvanceState();
+			break;
+		}
+
+		const FInteractionQueryResult& Query = Comp->GetCachedQueryResult();
+		Comp->BeginInteract();
+		++Interactions;
+		++InteractionsDone;
+
+		if (Comp->IsHolding())
+		{
+			// Every other hold is released halfway to exercise the reset path.
+			const float HoldTime = (InteractionsDone % 2 == 0) ? Query.HoldDuration * 0.5f : Query.HoldDuration + 0.1f;
+			HoldReleaseTime = Now + HoldTime;
+			SetPhase(EPhase::Holding);
+		}
+		else
+		{
+			Comp->EndInteract();
+		}
+		break;
+	}
+
+	case EPhase::Holding:
+		if (Now >= HoldReleaseTime || !Comp->IsHolding())
+		{
+			Comp->EndInteract();
+			SetPhase(EPhase::Interact);
+		}
+		break;
+	}
+}
+
+void AInteractionSoakBotController::GatherTargets()
+{
+	Targets.Reset();
+
+	const UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this);
+	if (!Registry) return;
+
+	for (const TWeakObjectPtr<UObject>& Weak : Registry->GetRegisteredInteractables())
+	{
+		UObject* Object = Weak.Get();
+		const IInteractable* Interactable = Cast<IInteractable>(Object);
+		if (!Interactable) continue;
+
+		// Actors are interactable themselves as well as through their slots; instanced components only per instance.
+		if (!Interactable->HasInteractionItems() || Cast<AActor>(Object))
+		{
+			Targets.Add({ Object, INDEX_NONE });
+		}
+
+		const int32 NumItems = Interactable->HasInteractionItems() ? Interactable->GetNumInteractionItems() : 0;
+		for (int32 Item = 0; Item < NumItems; ++Item)
+		{
+			Targets.Add({ Object, Item });
+		}
+	}
+}
+
+UObject* AInteractionSoakBotController::GetCurrentTarget() const
+{
+	return Targets.IsValidIndex(TargetIndex) ? Targets[TargetIndex].Interactable.Get() : nullptr;
+}
+
+bool AInteractionSoakBotController::IsTargetFocused() const
+{
+	const UInteractionComponent* Comp = InteractionComp.Get();
+	const UObject* Target = GetCurrentTarget();
+	return Comp && Target && Comp->GetFocusedInteractable() == Target && Comp->GetFocusedItem() == Targets[TargetIndex].Item;
+}
+
+void AInteractionSoakBotController::AdvanceTarget()
+{
+	++TargetIndex;
+
+	if (!Targets.IsValidIndex(TargetIndex))
+	{
+		// New lap; pick up anything spawned since the last one.
+		if (TargetIndex > 0)
+		{
+			++Laps;
+		}
+		GatherTargets();
+		TargetIndex = 0;
+
+		if (Targets.Num() == 0)
+		{
+			TargetIndex = INDEX_NONE;
+			return;
+		}
+	}
+
+	const IInteractable* Interactable = Cast<IInteractable>(GetCurrentTarget());
+	if (!Interactable) return;
+
+	++TargetsVisited;
+
+	TargetStates.Reset();
+	Interactable->GetInteractionStateIds(TargetStates);
+	StateIndex = 0;
+	InteractionsDone = 0;
+
+	PlacePawnInFrontOf(Targets[TargetIndex]);
+	SetPhase(EPhase::AcquireFocus);
+}
+
+void AInteractionSoakBotController::AdvanceState()
+{
+	++StateIndex;
+	InteractionsDone = 0;
+
+	// Instanced components force the state of all their instances, which is fine for a soak run.
+	IInteractable* Interactable = Cast<IInteractable>(GetCurrentTarget());
+	if (!Interactable || !TargetStates.IsValidIndex(StateIndex))
+	{
+		SetPhase(EPhase::NextTarget);
+		return;
+	}
+
+	Interactable->ForceInteractionState(TargetStates[StateIndex]);
+
+	// Toggling the component re-scans and re-queries immediately, so the new state is what gets interacted with.
+	if (UInteractionComponent* Comp = InteractionComp.Get())
+	{
+		Comp->DisableInteraction();
+		Comp->EnableInteraction();
+	}
+	SetPhase(EPhase::AcquireFocus);
+}
+
+void AInteractionSoakBotController::PlacePawnInFrontOf(const FSoakTarget& Target)
+{
+	APawn* MyPawn = GetPawn();
+	const UInteractionComponent* Comp = InteractionComp.Get();
+	const UObject* Object = Target.Interactable.Get();
+	const AActor* TargetActor = InteractionUtils::GetInteractableActor(Object);
+	if (!MyPawn || !Comp || !TargetActor) return;
+
+	FVector Origin;
+	float Standoff = InteractionSoakBot::ItemStandoff;
+	const IInteractable* Interactable = Cast<IInteractable>(Object);
+	if (Target.Item == INDEX_NONE || !Interactable || !Interactable->GetInteractionItemLocation(Target.Item, Origin))
+	{
+		FVector Extent;
+		TargetActor->GetActorBounds(true, Origin, Extent);
+		Standoff = Extent.Size2D() + 60.f;
+	}
+
+	FVector Facing = TargetActor->GetActorForwardVector().GetSafeNormal2D();
+	if (Facing.IsNearlyZero())
+	{
+		Facing = FVector::ForwardVector;
+	}
+
+	Standoff = FMath::Min(Standoff, Comp->TraceDistance * 0.8f);
+	const FVector EyeLocation = Origin + Facing * Standoff;
+	const FRotator LookRotation = (Origin - EyeLocation).Rotation();
+
+	MyPawn->SetActorLocationAndRotation(EyeLocation - FVector(0.f, 0.f, MyPawn->BaseEyeHeight), LookRotation, false, nullptr, ETeleportType::TeleportPhysics);
+	SetControlRotation(LookRotation);
+}
+
+void AInteractionSoakBotController::SetPhase(EPhase NewPhase)
+{
+	Phase = NewPhase;
+	PhaseStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+}
+
+void AInteractionSoakBotController::TrackFrameTime()
+{
+	const double NowReal = FPlatformTime::Seconds();
+	const float FrameMs = static_cast<float>((NowReal - LastFrameRealTime) * 1000.0);
+	LastFrameRealTime = NowReal;
+
+	WorstFrameMs = FMath::Max(WorstFrameMs, FrameMs);
+	if (FrameMs > HitchThresholdMs)
+	{
+		++HitchFrames;
+		UE_LOG(LogInteractionFramework, Warning, TEXT("[SoakBot] Hitch: %.1f ms frame while on %s."),
+			FrameMs, Targets.IsValidIndex(TargetIndex) ? *GetNameSafe(GetCurrentTarget()) : TEXT("<none>"));
+	}
+
+	if (NowReal >= NextReportRealTime)
+	{
+		Report(TEXT("Progress"));
+		NextReportRealTime = NowReal + ReportInterval;
+	}
+
+	if (RunEndRealTime > 0.0 && NowReal >= RunEndRealTime)
+	{
+		Report(TEXT("Finished"));
+		if (APawn* MyPawn = GetPawn())
+		{
+			MyPawn->Destroy();
+		}
+		Destroy();
+	}
+}
+
+void AInteractionSoakBotController::Report(const TCHAR* Reason)
+{
+	const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	const int32 ObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+	int32 Components = 0;
+	int32 ActiveTimers = 0;
+	for (TObjectIterator<UInteractionComponent> It; It; ++It)
+	{
+		if (It->GetWorld() == GetWorld())
+		{
+			++Components;
+			ActiveTimers += It->GetNumActiveTimers();
+		}
+	}
+
+	UE_LOG(LogInteractionFramework, Display,
+		TEXT("[SoakBot] %s after %.1f min | used memory %.1f MB (%+.1f MB) | UObjects %d (%+d) | interaction timers %d on %d components | laps %d, visited %d, skipped %d, interactions %d | hitches %d, worst frame %.1f ms"),
+		Reason,
+		(FPlatformTime::Seconds() - StartRealTime) / 60.0,
+		UsedPhysical / (1024.0 * 1024.0),
+		(static_cast<double>(UsedPhysical) - static_cast<double>(StartUsedPhysical)) / (1024.0 * 1024.0),
+		ObjectCount, ObjectCount - StartObjectCount,
+		ActiveTimers, Components,
+		Laps, TargetsVisited, TargetsSkipped, Interactions,
+		HitchFrames, WorstFrameMs);
+
+	WorstFrameMs = 0.f;
+}
+
+#endif
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "InteractionSoakBotController.generated.h"
+
+class UInteractionComponent;
+
+/**
+ * AInteractionSoakBotController
+ *
+ * Test-only bot for long headless soak runs. Teleports its pawn in front of every registered interactable
+ * (IInteractable actors, UInteractableComponent, and every instance of an instanced interactable),
+ * waits for the interaction component to focus it, runs the press/hold interaction through BeginInteract/EndInteract
+ * several times and then forces the next state, until every state of every target has been exercised. Laps repeat
+ * until the run time is over.
+ *
+ * Periodically logs memory growth, UObject count, active interaction timers and hitch frames, so leaks
+ * (unbound delegates, timers left on destroyed actors) show up as steady growth over hours.
+ *
+ * Started with Interaction.SoakBot.Start [Hours], stopped with Interaction.SoakBot.Stop.
+ * Compiled out of shipping builds: only the reflected shell of the class remains there.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown)
+class INTERACTIONFRAMEWORK_API AInteractionSoakBotController : public AAIController
+{
+	GENERATED_BODY()
+
+public:
+	AInteractionSoakBotController();
+
+#if !UE_BUILD_SHIPPING
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** Spawns a soak bot and its pawn in World. Hours <= 0 runs until stopped. */
+	static AInteractionSoakBotController* StartSoak(UWorld* World, float Hours);
+	static void StopSoak(UWorld* World);
+#endif
+
+public:
+	/** Interactions run per state before moving to the next state. */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Soak")
+	int32 InteractionsPerState = 3;
+
+	/** How long to wait for the scan to focus a target before skipping it. */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Soak")
+	float FocusTimeout = 1.f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Soak")
+	float ReportInterval = 60.f;
+
+	/** Frames taking longer than this (real time) count as hitches. */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Soak")
+	float HitchThresholdMs = 50.f;
+
+#if !UE_BUILD_SHIPPING
+protected:
+	virtual void OnPossess(APawn* InPawn) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	enum class EPhase : uint8
+	{
+		NextTarget,
+		AcquireFocus,
+		Interact,
+		Holding,
+	};
+
+	/** An interactable object, or one of its items (instances, slots). */
+	struct FSoakTarget
+	{
+		TWeakObjectPtr<UObject> Interactable;
+		int32 Item = INDEX_NONE;
+	};
+
+	TWeakObjectPtr<UInteractionComponent> InteractionComp;
+
+	TArray<FSoakTarget> Targets;
+	int32 TargetIndex = INDEX_NONE;
+	TArray<FName> TargetStates;
+	int32 StateIndex = 0;
+	int32 InteractionsDone = 0;
+
+	EPhase Phase = EPhase::NextTarget;
+	double PhaseStartTime = 0.0;
+	double HoldReleaseTime = 0.0;
+
+	// Run statistics
+	double RunEndRealTime = 0.0;
+	double LastFrameRealTime = 0.0;
+	double NextReportRealTime = 0.0;
+	double StartRealTime = 0.0;
+	uint64 StartUsedPhysical = 0;
+	int32 StartObjectCount = 0;
+	int32 Laps = 0;
+	int32 TargetsVisited = 0;
+	int32 TargetsSkipped = 0;
+	int32 Interactions = 0;
+	int32 HitchFrames = 0;
+	float WorstFrameMs = 0.f;
+
+	void BeginRun(float Hours);
+	void GatherTargets();
+	UObject* GetCurrentTarget() const;
+	bool IsTargetFocused() const;
+	void AdvanceTarget();
+	void AdvanceState();
+	void PlacePawnInFrontOf(const FSoakTarget& Target);
+	void SetPhase(EPhase NewPhase);
+	void TrackFrameTime();
+	void Report(const TCHAR* Reason);
+#endif
+};
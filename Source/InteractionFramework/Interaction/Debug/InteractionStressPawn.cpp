@@ -0,0 +1,75 @@
+#include "InteractionStressPawn.h"
+#include "AIController.h"
+#include "Components/SceneComponent.h"
+#include "Interaction/InteractionComponent.h"
+#include "Interaction/InteractionRegistrySubsystem.h"
+#include "Interaction/InteractionUtils.h"
+#include "Interaction/KeyringComponent.h"
+
+AInteractionStressPawn::AInteractionStressPawn()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	InteractionComponent = CreateDefaultSubobject<UInteractionComponent>(TEXT("Interaction"));
+	KeyringComponent = CreateDefaultSubobject<UKeyringComponent>(TEXT("Keyring"));
+	InteractionComponent->bFlightRecordAllInteractors = true;
+
+	// Traces start at the actor origin, level with the interactables.
+	BaseEyeHeight = 0.f;
+	bUseControllerRotationYaw = false;
+
+	AIControllerClass = AAIController::StaticClass();
+	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
+}
+
+#if !UE_BUILD_SHIPPING
+
+void AInteractionStressPawn::BeginPlay()
+{
+	Super::BeginPlay();
+	PickWanderTarget();
+}
+
+void AInteractionStressPawn::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!bWanderEnabled) return;
+
+	const AActor* Target = WanderTarget.Get();
+	if (!Target)
+	{
+		PickWanderTarget();
+		return;
+	}
+
+	FVector ToTarget = Target->GetActorLocation() - GetActorLocation();
+	ToTarget.Z = 0.f;
+
+	const float Distance = ToTarget.Size();
+	if (Distance <= AcceptanceRadius)
+	{
+		PickWanderTarget();
+		return;
+	}
+
+	const FVector Direction = ToTarget / Distance;
+	const float Step = FMath::Min(WanderSpeed * DeltaSeconds, Distance - AcceptanceRadius);
+	SetActorLocationAndRotation(GetActorLocation() + Direction * Step, Direction.Rotation());
+}
+
+void AInteractionStressPawn::PickWanderTarget()
+{
+	WanderTarget = nullptr;
+
+	const UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this);
+	if (!Registry) return;
+
+	const TArray<TWeakObjectPtr<UObject>>& Interactables = Registry->GetRegisteredInteractables();
+	if (Interactables.Num() == 0) return;
+
+	WanderTarget = InteractionUtils::GetInteractableActor(Interactables[Random.RandHelper(Interactables.Num())].Get());
+}
+
+#endif
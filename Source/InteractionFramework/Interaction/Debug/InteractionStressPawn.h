@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Pawn.h"
+#include "Math/RandomStream.h"
+#include "InteractionStressPawn.generated.h"
+
+class UInteractionComponent;
+class UKeyringComponent;
+
+/**
+ * AInteractionStressPawn
+ *
+ * AI-possessed pawn used by the multi-interactor stress test.
+ * Carries an interaction component and a keyring and wanders between registered interactables,
+ * facing the one it walks to, without navigation or physics so only the interaction cost scales.
+ * Compiled out of shipping builds: only the reflected shell of the class remains there.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown)
+class INTERACTIONFRAMEWORK_API AInteractionStressPawn : public APawn
+{
+	GENERATED_BODY()
+
+public:
+	AInteractionStressPawn();
+
+#if !UE_BUILD_SHIPPING
+	virtual void BeginPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
+
+	UInteractionComponent* GetInteractionComponent() const { return InteractionComponent; }
+	UKeyringComponent* GetKeyringComponent() const { return KeyringComponent; }
+
+	void SetRandomSeed(int32 Seed) { Random.Initialize(Seed); }
+#endif
+
+public:
+	/** When false the pawn stays where it is put, e.g. when a soak bot teleports it around. */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Stress")
+	bool bWanderEnabled = true;
+
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Stress")
+	float WanderSpeed = 300.f;
+
+	/** Distance at which the current target counts as reached and a new one is picked. */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Stress")
+	float AcceptanceRadius = 120.f;
+
+private:
+	UPROPERTY(VisibleAnywhere, Category="Components")
+	TObjectPtr<UInteractionComponent> InteractionComponent;
+
+	UPROPERTY(VisibleAnywhere, Category="Components")
+	TObjectPtr<UKeyringComponent> KeyringComponent;
+
+#if !UE_BUILD_SHIPPING
+	TWeakObjectPtr<AActor> WanderTarget;
+	FRandomStream Random;
+
+	void PickWanderTarget();
+#endif
+};
@@ -0,0 +1,191 @@
+#if WITH_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+#include "Interaction/Debug/InteractionBenchmark.h"
+#include "Interaction/Debug/InteractionStressPawn.h"
+#include "Interaction/InteractionComponent.h"
+#include "Interaction/KeyringComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectArray.h"
+
+namespace InteractionStressTest
+{
+	constexpr int32 WarmupFrames = 60;
+	constexpr int32 MeasuredFrames = 600;
+	constexpr int32 AllocationFrames = 120;
+}
+
+/**
+ * Spawns N AI pawns carrying UInteractionComponent + UKeyringComponent that wander among 2000 interactables,
+ * and ticks the world for 10 simulated seconds. Reports game-thread frame cost, interaction timer load and GC pressure
+ * per agent count so the scaling curve is visible across the test variants.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FInteractionStressTest,
+	"InteractionFramework.Stress.AIInteractors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::StressFilter)
+
+void FInteractionStressTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 Agents : { 50, 100, 250, 500 })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Agents"), Agents));
+		OutTestCommands.Add(FString::FromInt(Agents));
+	}
+}
+
+bool FInteractionStressTest::RunTest(const FString& Parameters)
+{
+	using namespace InteractionStressTest;
+
+	const int32 NumAgents = FCString::Atoi(*Parameters);
+	if (!TestTrue(TEXT("Agent count should be positive"), NumAgents > 0)) return false;
+
+	const FInteractionCrowdScenario Scenario;
+	FInteractionBenchmarkWorld BenchWorld;
+	UWorld* World = BenchWorld.GetWorld();
+	Scenario.SpawnInteractables(BenchWorld);
+
+	const int32 ObjectsBeforeAgents = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+	FRandomStream Random(NumAgents);
+	const float HalfExtent = BenchWorld.GetGridHalfExtent();
+
+	TArray<AInteractionStressPawn*> Agents;
+	Agents.Reserve(NumAgents);
+	for (int32 i = 0; i < NumAgents; ++i)
+	{
+		const FVector Location = Scenario.MakeAgentLocation(Random, HalfExtent);
+
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Params.bDeferConstruction = true;
+
+		AInteractionStressPawn* Pawn = World->SpawnActor<AInteractionStressPawn>(AInteractionStressPawn::StaticClass(), FTransform(Location), Params);
+		if (!Pawn) continue;
+
+		Pawn->SetRandomSeed(Random.RandHelper(MAX_int32));
+		Pawn->FinishSpawning(FTransform(Location));
+
+		// Mixed keyrings so both met and unmet requirements are queried.
+		for (int32 Key = 0; Key < 3; ++Key)
+		{
+			if (Random.FRand() < 0.5f)
+			{
+				Pawn->GetKeyringComponent()->AddKey(InteractionBenchmark::GetKeyId(Key));
+			}
+		}
+
+		Agents.Add(Pawn);
+	}
+
+	if (!TestEqual(TEXT("All agents should spawn"), Agents.Num(), NumAgents)) return false;
+	TestNotNull(TEXT("Agents should be AI controlled"), Agents[0]->GetController());
+
+	const int32 ObjectsPerAgent = (GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBeforeAgents) / NumAgents;
+
+	for (int32 Frame = 0; Frame < WarmupFrames; ++Frame)
+	{
+		BenchWorld.Tick(Scenario.FrameDeltaSeconds);
+	}
+
+	FInteractionBenchmarkSamples FrameSamples;
+	FrameSamples.Reserve(MeasuredFrames);
+	int64 TotalScans = 0;
+	int32 MaxScansInFrame = 0;
+	int32 FocusedAgentFrames = 0;
+
+	TArray<uint32> ScansBefore;
+	ScansBefore.Reserve(Agents.Num());
+	for (const AInteractionStressPawn* Agent : Agents)
+	{
+		ScansBefore.Add(Agent->GetInteractionComponent()->GetNumFocusScans());
+	}
+
+	const int32 ObjectsBeforeRun = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+	for (int32 Frame = 0; Frame < MeasuredFrames; ++Frame)
+	{
+		{
+			FInteractionBenchmarkScope Scope(FrameSamples);
+			BenchWorld.Tick(Scenario.FrameDeltaSeconds);
+		}
+
+		int32 ScansThisFrame = 0;
+		for (int32 i = 0; i < Agents.Num(); ++i)
+		{
+			const UInteractionComponent* Comp = Agents[i]->GetInteractionComponent();
+			const uint32 Scans = Comp->GetNumFocusScans();
+			ScansThisFrame += Scans - ScansBefore[i];
+			ScansBefore[i] = Scans;
+			FocusedAgentFrames += Comp->GetFocusedActor() ? 1 : 0;
+		}
+
+		TotalScans += ScansThisFrame;
+		MaxScansInFrame = FMath::Max(MaxScansInFrame, ScansThisFrame);
+	}
+
+	const int32 ObjectsCreatedDuringRun = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBeforeRun;
+
+	int32 ActiveTimers = 0;
+	for (const AInteractionStressPawn* Agent : Agents)
+	{
+		ActiveTimers += Agent->GetInteractionComponent()->GetNumActiveTimers();
+	}
+
+	// Allocation churn is counted in separate frames so the counting allocator does not skew frame times.
+	double AllocsPerFrame = 0.0;
+	double BytesPerFrame = 0.0;
+	{
+		FInteractionAllocationCounter Allocations;
+		Allocations.Start();
+		for (int32 Frame = 0; Frame < AllocationFrames; ++Frame)
+		{
+			BenchWorld.Tick(Scenario.FrameDeltaSeconds);
+		}
+		Allocations.Stop();
+		AllocsPerFrame = static_cast<double>(Allocations.GetNumAllocations()) / AllocationFrames;
+		BytesPerFrame = static_cast<double>(Allocations.GetNetBytes()) / AllocationFrames;
+	}
+
+	const uint64 GCStartCycles = FPlatformTime::Cycles64();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const double GCMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - GCStartCycles);
+
+	const double ScansPerFrame = static_cast<double>(TotalScans) / MeasuredFrames;
+	TestTrue(TEXT("Agents should scan while wandering"), TotalScans > 0);
+	TestTrue(TEXT("Agents should focus interactables while wandering"), FocusedAgentFrames > 0);
+
+	const TSharedRef<FJsonObject> Timers = MakeShared<FJsonObject>();
+	Timers->SetNumberField(TEXT("active_interaction_timers"), ActiveTimers);
+	Timers->SetNumberField(TEXT("scans_per_frame"), ScansPerFrame);
+	Timers->SetNumberField(TEXT("max_scans_in_frame"), MaxScansInFrame);
+
+	const TSharedRef<FJsonObject> GC = MakeShared<FJsonObject>();
+	GC->SetNumberField(TEXT("uobjects_per_agent"), ObjectsPerAgent);
+	GC->SetNumberField(TEXT("uobjects_created_during_run"), ObjectsCreatedDuringRun);
+	GC->SetNumberField(TEXT("allocs_per_frame"), AllocsPerFrame);
+	GC->SetNumberField(TEXT("net_bytes_per_frame"), BytesPerFrame);
+	GC->SetNumberField(TEXT("full_gc_ms"), GCMs);
+
+	const TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	Results->SetNumberField(TEXT("agents"), NumAgents);
+	Results->SetNumberField(TEXT("interactables"), Scenario.NumInteractables);
+	Results->SetNumberField(TEXT("frames"), MeasuredFrames);
+	Results->SetObjectField(TEXT("game_thread_frame"), FrameSamples.ToJson());
+	Results->SetNumberField(TEXT("focused_agent_ratio"), static_cast<double>(FocusedAgentFrames) / (static_cast<double>(MeasuredFrames) * NumAgents));
+	Results->SetObjectField(TEXT("timers"), Timers);
+	Results->SetObjectField(TEXT("gc"), GC);
+
+	AddInfo(FString::Printf(TEXT("Agents=%d frame mean %.2fms p99 %.2fms | %d timers, %.1f scans/frame (max %d) | %.0f allocs/frame, %d UObjects/agent, full GC %.2fms"),
+		NumAgents, FrameSamples.GetMean() / 1000.0, FrameSamples.GetPercentile(0.99) / 1000.0,
+		ActiveTimers, ScansPerFrame, MaxScansInFrame, AllocsPerFrame, ObjectsPerAgent, GCMs));
+
+	const FString Path = InteractionBenchmark::WriteResults(FString::Printf(TEXT("AIStress_%d"), NumAgents), Results);
+	TestFalse(TEXT("Stress results should be written"), Path.IsEmpty());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,160 @@
+#include "InteractionTrace.h"
+
+#if INTERACTION_TRACE_ENABLED
+
+#include "Trace/Trace.inl"
+#include "GameFramework/Actor.h"
+#include "Interaction/Data/InteractionTypes.h"
+
+UE_TRACE_CHANNEL_DEFINE(InteractionChannel)
+
+UE_TRACE_EVENT_BEGIN(Interaction, ScanBegin)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InteractorId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Interaction, ScanEnd)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InteractorId)
+	UE_TRACE_EVENT_FIELD(uint32, FocusedId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Interaction, Hit)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InteractorId)
+	UE_TRACE_EVENT_FIELD(uint32, HitActorId)
+	UE_TRACE_EVENT_FIELD(bool, bInteractable)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, HitActorName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Interaction, FocusChanged)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InteractorId)
+	UE_TRACE_EVENT_FIELD(uint32, NewFocusId)
+	UE_TRACE_EVENT_FIELD(uint32, PrevFocusId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, NewFocusName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Interaction, QueryResult)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InteractorId)
+	UE_TRACE_EVENT_FIELD(uint32, TargetId)
+	UE_TRACE_EVENT_FIELD(bool, bShowPrompt)
+	UE_TRACE_EVENT_FIELD(uint8, InputType)
+	UE_TRACE_EVENT_FIELD(int32, UnmetRequirements)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, PromptText)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Interaction, Interact)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InteractorId)
+	UE_TRACE_EVENT_FIELD(uint32, TargetId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Interaction, Hold)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InteractorId)
+	UE_TRACE_EVENT_FIELD(uint32, TargetId)
+	UE_TRACE_EVENT_FIELD(uint8, Event)
+	UE_TRACE_EVENT_FIELD(float, Progress)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Interaction, StateChanged)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InteractableId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, PreviousStateId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, NewStateId)
+UE_TRACE_EVENT_END()
+
+namespace
+{
+	uint32 GetTraceId(const AActor* Actor)
+	{
+		return Actor ? Actor->GetUniqueID() : 0;
+	}
+}
+
+void FInteractionTrace::OutputScanBegin(const AActor* Interactor)
+{
+	UE_TRACE_LOG(Interaction, ScanBegin, InteractionChannel)
+		<< ScanBegin.Cycle(FPlatformTime::Cycles64())
+		<< ScanBegin.InteractorId(GetTraceId(Interactor));
+}
+
+void FInteractionTrace::OutputScanEnd(const AActor* Interactor, const AActor* FocusedActor)
+{
+	UE_TRACE_LOG(Interaction, ScanEnd, InteractionChannel)
+		<< ScanEnd.Cycle(FPlatformTime::Cycles64())
+		<< ScanEnd.InteractorId(GetTraceId(Interactor))
+		<< ScanEnd.FocusedId(GetTraceId(FocusedActor));
+}
+
+void FInteractionTrace::OutputHit(const AActor* Interactor, const AActor* HitActor, bool bInteractable)
+{
+	const FString Name = GetNameSafe(HitActor);
+
+	UE_TRACE_LOG(Interaction, Hit, InteractionChannel)
+		<< Hit.Cycle(FPlatformTime::Cycles64())
+		<< Hit.InteractorId(GetTraceId(Interactor))
+		<< Hit.HitActorId(GetTraceId(HitActor))
+		<< Hit.bInteractable(bInteractable)
+		<< Hit.HitActorName(*Name, Name.Len());
+}
+
+void FInteractionTrace::OutputFocusChanged(const AActor* Interactor, const AActor* NewFocus, const AActor* PrevFocus)
+{
+	const FString Name = GetNameSafe(NewFocus);
+
+	UE_TRACE_LOG(Interaction, FocusChanged, InteractionChannel)
+		<< FocusChanged.Cycle(FPlatformTime::Cycles64())
+		<< FocusChanged.InteractorId(GetTraceId(Interactor))
+		<< FocusChanged.NewFocusId(GetTraceId(NewFocus))
+		<< FocusChanged.PrevFocusId(GetTraceId(PrevFocus))
+		<< FocusChanged.NewFocusName(*Name, Name.Len());
+}
+
+void FInteractionTrace::OutputQueryResult(const AActor* Interactor, const AActor* Target, const FInteractionQueryResult& Result)
+{
+	const FString& Prompt = Result.PromptText.ToString();
+
+	UE_TRACE_LOG(Interaction, QueryResult, InteractionChannel)
+		<< QueryResult.Cycle(FPlatformTime::Cycles64())
+		<< QueryResult.InteractorId(GetTraceId(Interactor))
+		<< QueryResult.TargetId(GetTraceId(Target))
+		<< QueryResult.bShowPrompt(Result.bShouldShowPrompt)
+		<< QueryResult.InputType(static_cast<uint8>(Result.InputType))
+		<< QueryResult.UnmetRequirements(Result.UnmetRequirementNumber)
+		<< QueryResult.PromptText(*Prompt, Prompt.Len());
+}
+
+void FInteractionTrace::OutputInteract(const AActor* Interactor, const AActor* Target)
+{
+	UE_TRACE_LOG(Interaction, Interact, InteractionChannel)
+		<< Interact.Cycle(FPlatformTime::Cycles64())
+		<< Interact.InteractorId(GetTraceId(Interactor))
+		<< Interact.TargetId(GetTraceId(Target));
+}
+
+void FInteractionTrace::OutputHold(const AActor* Interactor, const AActor* Target, EInteractionTraceHoldEvent Event, float Progress)
+{
+	UE_TRACE_LOG(Interaction, Hold, InteractionChannel)
+		<< Hold.Cycle(FPlatformTime::Cycles64())
+		<< Hold.InteractorId(GetTraceId(Interactor))
+		<< Hold.TargetId(GetTraceId(Target))
+		<< Hold.Event(static_cast<uint8>(Event))
+		<< Hold.Progress(Progress);
+}
+
+void FInteractionTrace::OutputStateChanged(const AActor* Interactable, FName PreviousStateId, FName NewStateId)
+{
+	const FString Prev = PreviousStateId.ToString();
+	const FString New = NewStateId.ToString();
+
+	UE_TRACE_LOG(Interaction, StateChanged, InteractionChannel)
+		<< StateChanged.Cycle(FPlatformTime::Cycles64())
+		<< StateChanged.InteractableId(GetTraceId(Interactable))
+		<< StateChanged.PreviousStateId(*Prev, Prev.Len())
+		<< StateChanged.NewStateId(*New, New.Len());
+}
+
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Config.h"
+#include "Trace/Trace.h"
+
+/**
+ * Unreal Insights events for the interaction framework.
+ *
+ * Enable with "-trace=default,Interaction" (or "Trace.Enable Interaction" at runtime).
+ * Every event carries a cycle timestamp and the UniqueID of the actors involved, so interaction
+ * activity can be lined up with hitches on the Insights timeline.
+ *
+ * The TRACE_INTERACTION_* macros only test the channel when it is disabled; event arguments
+ * (names, strings) are not evaluated in that case.
+ */
+
+#if !defined(INTERACTION_TRACE_ENABLED)
+	#define INTERACTION_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+class AActor;
+struct FInteractionQueryResult;
+
+enum class EInteractionTraceHoldEvent : uint8
+{
+	Begin,
+	Complete,
+	Reset
+};
+
+#if INTERACTION_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(InteractionChannel, INTERACTIONFRAMEWORK_API);
+
+struct INTERACTIONFRAMEWORK_API FInteractionTrace
+{
+	static void OutputScanBegin(const AActor* Interactor);
+	static void OutputScanEnd(const AActor* Interactor, const AActor* FocusedActor);
+	static void OutputHit(const AActor* Interactor, const AActor* HitActor, bool bInteractable);
+	static void OutputFocusChanged(const AActor* Interactor, const AActor* NewFocus, const AActor* PrevFocus);
+	static void OutputQueryResult(const AActor* Interactor, const AActor* Target, const FInteractionQueryResult& Result);
+	static void OutputInteract(const AActor* Interactor, const AActor* Target);
+	static void OutputHold(const AActor* Interactor, const AActor* Target, EInteractionTraceHoldEvent Event, float Progress);
+	static void OutputStateChanged(const AActor* Interactable, FName PreviousStateId, FName NewStateId);
+};
+
+#define INTERACTION_TRACE_EVENT(Call) \
+	do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(InteractionChannel)) { FInteractionTrace::Call; } } while (0)
+
+#define TRACE_INTERACTION_SCAN_BEGIN(Interactor)                      INTERACTION_TRACE_EVENT(OutputScanBegin(Interactor))
+#define TRACE_INTERACTION_SCAN_END(Interactor, FocusedActor)          INTERACTION_TRACE_EVENT(OutputScanEnd(Interactor, FocusedActor))
+#define TRACE_INTERACTION_HIT(Interactor, HitActor, bInteractable)    INTERACTION_TRACE_EVENT(OutputHit(Interactor, HitActor, bInteractable))
+#define TRACE_INTERACTION_FOCUS_CHANGED(Interactor, NewFocus, Prev)   INTERACTION_TRACE_EVENT(OutputFocusChanged(Interactor, NewFocus, Prev))
+#define TRACE_INTERACTION_QUERY(Interactor, Target, Result)           INTERACTION_TRACE_EVENT(OutputQueryResult(Interactor, Target, Result))
+#define TRACE_INTERACTION_INTERACT(Interactor, Target)                INTERACTION_TRACE_EVENT(OutputInteract(Interactor, Target))
+#define TRACE_INTERACTION_HOLD(Interactor, Target, Event, Progress)   INTERACTION_TRACE_EVENT(OutputHold(Interactor, Target, Event, Progress))
+#define TRACE_INTERACTION_STATE_CHANGED(Interactable, Prev, New)      INTERACTION_TRACE_EVENT(OutputStateChanged(Interactable, Prev, New))
+
+#else
+
+#define TRACE_INTERACTION_SCAN_BEGIN(...)
+#define TRACE_INTERACTION_SCAN_END(...)
+#define TRACE_INTERACTION_HIT(...)
+#define TRACE_INTERACTION_FOCUS_CHANGED(...)
+#define TRACE_INTERACTION_QUERY(...)
+#define TRACE_INTERACTION_INTERACT(...)
+#define TRACE_INTERACTION_HOLD(...)
+#define TRACE_INTERACTION_STATE_CHANGED(...)
+
+#endif
@@ -0,0 +1,165 @@
+#include "InteractionWorldInspector.h"
+#include "Interaction/Interactable.h"
+#include "Interaction/InteractionComponent.h"
+#include "Interaction/InteractionRegistrySubsystem.h"
+#include "Interaction/InteractionUtils.h"
+#include "Interaction/KeyringComponent.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "SceneView.h"
+#include "UObject/UObjectIterator.h"
+
+static TAutoConsoleVariable<float> CVarWorldInspectorRange(
+	TEXT("Interaction.Debug.WorldInspectorRange"),
+	1500.f,
+	TEXT("Max distance (cm) from the view at which the world inspector labels interactables."));
+
+static FAutoConsoleCommandWithWorld GToggleWorldInspectorCommand(
+	TEXT("Interaction.Debug.WorldInspector"),
+	TEXT("Toggles the world interactable inspector for every interaction component in the world."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		for (TObjectIterator<UInteractionComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->HasBegunPlay())
+			{
+				It->ToggleWorldInspector();
+			}
+		}
+	}));
+
+void UInteractionWorldInspector::Initialize(const UInteractionComponent* InOwnerComp)
+{
+	OwnerComp = InOwnerComp;
+}
+
+void UInteractionWorldInspector::SetEnabled(bool bInEnabled)
+{
+	if (bEnabled == bInEnabled) return;
+
+	bEnabled = bInEnabled;
+
+	if (bEnabled)
+	{
+		DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UInteractionWorldInspector::DrawOverlay));
+	}
+	else
+	{
+		UDebugDrawService::Unregister(DrawHandle);
+		DrawHandle.Reset();
+		LabelCache.Empty();
+		VisibleLabels.Empty();
+	}
+}
+
+void UInteractionWorldInspector::BeginDestroy()
+{
+	if (DrawHandle.IsValid())
+	{
+		UDebugDrawService::Unregister(DrawHandle);
+		DrawHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+void UInteractionWorldInspector::DrawOverlay(UCanvas* Canvas, APlayerController* PC)
+{
+	const UInteractionComponent* Comp = OwnerComp.Get();
+	if (!bEnabled || !Comp || !Canvas || !Canvas->SceneView || !GEngine) return;
+
+	AActor* Interactor = Comp->GetOwner();
+
+	// Only draw into the viewport of the player that owns this interactor.
+	if (const APawn* OwnerPawn = Cast<APawn>(Interactor))
+	{
+		if (PC && OwnerPawn->GetController() && OwnerPawn->GetController() != PC) return;
+	}
+
+	const UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(Comp);
+	if (!Registry) return;
+
+	const UKeyringComponent* Keyring = Interactor ? Interactor->FindComponentByClass<UKeyringComponent>() : nullptr;
+	const uint32 KeyringRevision = Keyring ? Keyring->GetRevision() : 0;
+
+	const FSceneView& View = *Canvas->SceneView;
+	const FVector ViewOrigin = View.ViewMatrices.GetViewOrigin();
+	const float Range = CVarWorldInspectorRange.GetValueOnGameThread();
+	const double RangeSq = FMath::Square(static_cast<double>(Range));
+	constexpr float CullRadius = 50.f;
+
+	VisibleLabels.Reset();
+
+	// Cull and refresh stale labels
+	for (const TWeakObjectPtr<UObject>& WeakInteractable : Registry->GetRegisteredInteractables())
+	{
+		UObject* Object = WeakInteractable.Get();
+		if (!Object) continue;
+
+		const FVector Location = InteractionUtils::GetInteractableLocation(Object);
+		if (FVector::DistSquared(Location, ViewOrigin) > RangeSq) continue;
+		if (!View.ViewFrustum.IntersectSphere(Location, CullRadius)) continue;
+
+		const IInteractable* Interactable = Cast<IInteractable>(Object);
+		const FName StateId = Interactable ? Interactable->GetInteractionStateId() : NAME_None;
+
+		FLabelCacheEntry& Entry = LabelCache.FindOrAdd(WeakInteractable);
+		if (Entry.Label.IsEmpty() || Entry.StateId != StateId || Entry.KeyringRevision != KeyringRevision)
+		{
+			Entry.StateId = StateId;
+			Entry.KeyringRevision = KeyringRevision;
+			RebuildLabel(Object, Interactor, Entry);
+		}
+
+		const FVector Screen = Canvas->Project(Location);
+		if (Screen.Z <= 0.f) continue;
+
+		VisibleLabels.Add({ FVector2D(Screen), WeakInteractable });
+	}
+
+	// Single pass over all visible labels with a shared font
+	UFont* Font = GEngine->GetTinyFont();
+	for (const FVisibleLabel& Label : VisibleLabels)
+	{
+		const FLabelCacheEntry* Entry = LabelCache.Find(Label.Interactable);
+		if (!Entry) continue;
+
+		Canvas->SetDrawColor(Entry->Color);
+		Canvas->DrawText(Font, Entry->Label, Label.ScreenPosition.X, Label.ScreenPosition.Y);
+	}
+
+	if (LabelCache.Num() > Registry->GetNumRegisteredInteractables() * 2 + 64)
+	{
+		PruneLabelCache();
+	}
+}
+
+void UInteractionWorldInspector::RebuildLabel(UObject* Interactable, AActor* Interactor, FLabelCacheEntry& Entry) const
+{
+	const FInteractionQueryResult Query = IInteractable::Execute_QueryInteraction(Interactable, Interactor);
+	const bool bAvailable = Query.IsAvailable();
+
+	Entry.Label = FString::Printf(TEXT("%s\nState: %s | %s\nPrompt: %s"),
+		*GetNameSafe(InteractionUtils::GetInteractableActor(Interactable)),
+		*Entry.StateId.ToString(),
+		bAvailable ? TEXT("Available") : *FString::Printf(TEXT("Missing %d"), Query.UnmetRequirementNumber),
+		Query.bShouldShowPrompt ? *Query.PromptText.ToString() : TEXT("<hidden>"));
+
+	Entry.Color = !Query.bShouldShowPrompt ? FColor::Silver : (bAvailable ? FColor::Green : FColor::Red);
+}
+
+void UInteractionWorldInspector::PruneLabelCache()
+{
+	for (auto It = LabelCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "InteractionWorldInspector.generated.h"
+
+class UCanvas;
+class APlayerController;
+class UInteractionComponent;
+
+/**
+ * UInteractionWorldInspector
+ *
+ * Debug overlay that labels every registered interactable near the viewer with its state id,
+ * availability for the owner's keyring and prompt text.
+ *
+ * Stays cheap with many interactables:
+ * - distance and view frustum culling before anything else is touched
+ * - label strings are cached per actor and only rebuilt when its state id or the keyring revision changes
+ * - all visible labels are drawn in a single canvas pass
+ */
+UCLASS()
+class INTERACTIONFRAMEWORK_API UInteractionWorldInspector : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(const UInteractionComponent* InOwnerComp);
+
+	void SetEnabled(bool bInEnabled);
+	bool IsEnabled() const { return bEnabled; }
+
+	virtual void BeginDestroy() override;
+
+private:
+	struct FLabelCacheEntry
+	{
+		FName StateId = NAME_None;
+		uint32 KeyringRevision = 0;
+		FString Label;
+		FColor Color = FColor::White;
+	};
+
+	struct FVisibleLabel
+	{
+		FVector2D ScreenPosition = FVector2D::ZeroVector;
+
+		/** Key into LabelCache. Not a pointer: adding to the cache later in the same pass may move its entries. */
+		TWeakObjectPtr<UObject> Interactable;
+	};
+
+	TWeakObjectPtr<const UInteractionComponent> OwnerComp;
+	bool bEnabled = false;
+	FDelegateHandle DrawHandle;
+
+	TMap<TWeakObjectPtr<UObject>, FLabelCacheEntry> LabelCache;
+
+	/** Reused every frame to avoid per-frame allocations. */
+	TArray<FVisibleLabel> VisibleLabels;
+
+	void DrawOverlay(UCanvas* Canvas, APlayerController* PC);
+	void RebuildLabel(UObject* Interactable, AActor* Interactor, FLabelCacheEntry& Entry) const;
+	void PruneLabelCache();
+};
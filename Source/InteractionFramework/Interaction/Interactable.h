@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "Engine/HitResult.h"
 #include "Interaction/Data/InteractionTypes.h"
 #include "Interactable.generated.h"
 
@@ -52,4 +53,76 @@ public:
 	/** Cosmetic hook called when this object is no longer the focused interaction target. */
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="Interaction")
 	void OnFocusEnd(AActor* Interactor);
+
+	/** Current state id, for debug tooling and change detection. None if the implementer has no states. */
+	virtual FName GetInteractionStateId() const { return NAME_None; }
+
+	/** Every state id this object can be in, for tooling that walks through all states. */
+	virtual void GetInteractionStateIds(TArray<FName>& OutStateIds) const {}
+
+	/** Switches to the given state for tooling. Returns false if the state is unknown or states are not supported. */
+	virtual bool ForceInteractionState(FName StateId) { return false; }
+
+	/**
+	 * Objects made of many individually interactable items (e.g. mesh instances) return true and implement the item hooks.
+	 * The interaction component then focuses, queries and interacts per item instead of per object.
+	 */
+	virtual bool HasInteractionItems() const { return false; }
+
+	/** Number of items; valid items are [0, Num). For tooling that walks through all items. */
+	virtual int32 GetNumInteractionItems() const { return 0; }
+
+	/** Item a trace hit resolves to (the hit's Item by default), INDEX_NONE when the hit is on no item. */
+	virtual int32 GetInteractionItemForHit(const FHitResult& Hit) const { return Hit.Item; }
+	virtual FInteractionQueryResult QueryInteractionItem(AActor* Interactor, int32 Item) const { return FInteractionQueryResult{}; }
+	virtual void InteractItem(AActor* Interactor, int32 Item) {}
+
+	/** Current state id of an item, for change detection. None if the item does not exist or cannot be interacted with. */
+	virtual FName GetInteractionItemStateId(int32 Item) const { return NAME_None; }
+
+	/** World location of an item, for range checks. False when the item does not exist. */
+	virtual bool GetInteractionItemLocation(int32 Item, FVector& OutLocation) const { return false; }
+
+	/**
+	 * Deferred initialization: objects that queue themselves with UInteractionRegistrySubsystem::RequestInitialization
+	 * report false until InitializeInteraction ran (time-sliced by the registry, or on demand when focused).
+	 */
+	virtual bool IsInteractionInitialized() const { return true; }
+	virtual void InitializeInteraction() {}
+
+	/**
+	 * State persistence across streaming (see UInteractionPersistenceSubsystem). Objects without a valid
+	 * persistent id are not persisted. The state is an index into the object's data asset states.
+	 */
+	virtual FGuid GetPersistentId() const { return FGuid(); }
+	virtual bool GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const { return false; }
+	virtual bool RestorePersistentState(int32 StateIndex, EInteractionPersistFlags Flags) { return false; }
+
+	/** Data asset the persistent state index refers to, so saves can detect reordered states. */
+	virtual const UObject* GetPersistentDataAsset() const { return nullptr; }
+
+	/**
+	 * Items (slots, instances) persisted next to the object's own state, each under an id derived from the
+	 * object's persistent id (UInteractionPersistenceSubsystem::MakeItemId).
+	 */
+	virtual int32 GetNumPersistentItems() const { return 0; }
+	virtual bool GetPersistentItemState(int32 Item, int32& OutStateIndex) const { return false; }
+	virtual bool RestorePersistentItemState(int32 Item, int32 StateIndex) { return false; }
+	virtual const UObject* GetPersistentItemDataAsset(int32 Item) const { return nullptr; }
+
+	/**
+	 * Client prediction: drops state changes made by interacts predicted on this client and re-applies the state
+	 * last replicated from the server. Called once the server has answered every pending interact on this object.
+	 */
+	virtual void RevertToReplicatedState() {}
+
+	/**
+	 * Whether AI agents may currently use this object (see UInteractionSmartObjectSubsystem and
+	 * UInteractionMassSubsystem). Implementers with states report the current state's bAvailableToAI and call
+	 * UInteractionRegistrySubsystem::NotifyStateChanged when it may have changed.
+	 */
+	virtual bool IsAvailableToAI() const { return true; }
+
+	/** Called by the registry when this object's significance tier changes. */
+	virtual void OnInteractionLodChanged(EInteractionLodTier NewTier) {}
 };
\ No newline at end of file
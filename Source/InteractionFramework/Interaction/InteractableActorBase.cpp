@@ -4,17 +4,146 @@
 #include "InteractionUtils.h"
 #include "Interaction/Data/InteractionDataAsset.h"
 #include "Interaction/Data/InteractionTypes.h"
-#include "KeyringComponent.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractionPersistenceSubsystem.h"
+#include "Debug/InteractionTrace.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 AInteractableActorBase::AInteractableActorBase()
 {
 	PrimaryActorTick.bCanEverTick = false;
+
+	// State changes force a net update, so idle interactables only need to be considered rarely.
+	bReplicates = true;
+	SetNetUpdateFrequency(1.f);
+}
+
+void AInteractableActorBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AInteractableActorBase, NetState, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AInteractableActorBase, SlotNetStates, Params);
 }
 
 void AInteractableActorBase::BeginPlay()
 {
 	Super::BeginPlay();
-	InitializeInteractionState();
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterInteractable(this);
+		Registry->RequestInitialization(this);
+	}
+	else
+	{
+		InitializeInteraction();
+	}
+}
+
+void AInteractableActorBase::InitializeInteraction()
+{
+	if (bInteractionInitialized) return;
+
+	bInteractionInitialized = true;
+
+	// Slots start from their authored states so restored slot states are applied on top, not reset afterwards.
+	InitializeSlots();
+
+	// State recorded when this actor last streamed out wins over the authored one. Clients get theirs from the server.
+	const UInteractionPersistenceSubsystem* Persistence = HasAuthority() ? UInteractionPersistenceSubsystem::Get(this) : nullptr;
+	if (!Persistence || !Persistence->Restore(*this))
+	{
+		InitializeInteractionState();
+	}
+}
+
+bool AInteractableActorBase::GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const
+{
+	// Never overwrite a recorded state with one that was not restored yet.
+	if (!bInteractionInitialized || !InteractionData) return false;
+
+	OutStateIndex = InteractionData->FindStateIndexById(CurrentStateId);
+	OutFlags = EInteractionPersistFlags::None;
+	return OutStateIndex != INDEX_NONE;
+}
+
+bool AInteractableActorBase::RestorePersistentState(int32 StateIndex, EInteractionPersistFlags Flags)
+{
+	if (!InteractionData || !InteractionData->States.IsValidIndex(StateIndex)) return false;
+
+	CurrentState = InteractionData->States[StateIndex];
+	CurrentStateId = CurrentState.StateId;
+	PushNetState();
+	return true;
+}
+
+bool AInteractableActorBase::GetPersistentItemState(int32 Item, int32& OutStateIndex) const
+{
+	if (!bInteractionInitialized || !SlotStateIndices.IsValidIndex(Item)) return false;
+
+	OutStateIndex = SlotStateIndices[Item];
+	return OutStateIndex != INDEX_NONE;
+}
+
+bool AInteractableActorBase::RestorePersistentItemState(int32 Item, int32 StateIndex)
+{
+	const UInteractionDataAsset* Data = GetSlotData(Item);
+	if (!Data || !Data->States.IsValidIndex(StateIndex) || !SlotStateIndices.IsValidIndex(Item)) return false;
+
+	SlotStateIndices[Item] = static_cast<int16>(StateIndex);
+	PushSlotNetState(Item);
+	return true;
+}
+
+void AInteractableActorBase::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+#if WITH_EDITOR
+	UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, false);
+#endif
+}
+
+#if WITH_EDITOR
+
+void AInteractableActorBase::PostEditImport()
+{
+	Super::PostEditImport();
+	UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, true);
+}
+
+void AInteractableActorBase::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	// PIE copies keep the id of the actor they were duplicated from.
+	if (!bDuplicateForPIE)
+	{
+		UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, true);
+	}
+}
+
+#endif
+
+void AInteractableActorBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this))
+	{
+		Persistence->Record(*this);
+	}
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterInteractable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AInteractableActorBase::InitializeInteractionState()
@@ -35,8 +164,21 @@ void AInteractableActorBase::InitializeInteractionState()
 	}
 }
 
+void AInteractableActorBase::GetInteractionStateIds(TArray<FName>& OutStateIds) const
+{
+	if (!InteractionData) return;
+
+	for (const FInteractionStateDefinition& State : InteractionData->States)
+	{
+		OutStateIds.Add(State.StateId);
+	}
+}
+
 bool AInteractableActorBase::SetInteractionState(FName NewStateId)
 {
+	// State set before deferred initialization ran, e.g. from a Blueprint BeginPlay.
+	InitializeInteraction();
+
 	if (!InteractionData) return false;
 
 	if (!NewStateId.IsNone())
@@ -48,8 +190,11 @@ bool AInteractableActorBase::SetInteractionState(FName NewStateId)
 
 		if (!InteractionData) return false; // Can not check if the provided new state id exists.
 
+		const FName PreviousStateId = CurrentStateId;
 		if (CacheStateFromId(NewStateId))
 		{
+			TRACE_INTERACTION_STATE_CHANGED(this, PreviousStateId, NewStateId);
+			PushNetState();
 			return true;
 		}
 	}
@@ -59,30 +204,7 @@ bool AInteractableActorBase::SetInteractionState(FName NewStateId)
 
 FInteractionQueryResult AInteractableActorBase::QueryInteraction_Implementation(AActor* Interactor) const
 {
-	FInteractionQueryResult Result{};
-
-	// No data means no prompt
-	if (!InteractionData || !CurrentState.IsValid())
-	{
-		Result.bShouldShowPrompt = false;
-		return Result;
-	}
-
-	// Copy UI info from data asset
-	Result.bShouldShowPrompt = InteractionData->ShouldShowPromptForState(CurrentState);
-	Result.PromptText        = CurrentState.PromptText;
-	Result.InputType         = CurrentState.InputType;
-	Result.HoldDuration      = CurrentState.HoldDuration;
-	Result.bShouldShowRequirements = CurrentState.bShouldShowRequirements;
-
-	// Only do requirement check if there are any requirements
-	if (CurrentState.RequiredKeys.Num() > 0)
-	{
-		GetMissingRequirementMessages(Interactor, Result.UnmetRequirementMessages);
-		Result.UnmetRequirementNumber = Result.UnmetRequirementMessages.Num();
-	}
-
-	return Result;
+	return InteractionUtils::BuildQueryResult(InteractionData, &CurrentState, Interactor);
 }
 
 bool AInteractableActorBase::GetMissingRequirementMessages(AActor* Interactor, TArray<FText>& OutMissingMessages) const
@@ -93,17 +215,8 @@ bool AInteractableActorBase::GetMissingRequirementMessages(AActor* Interactor, T
 	{
 		return false;
 	}
-	
-	const TArray<FInteractionKeyRequirement>& Reqs = CurrentState.RequiredKeys;
-	if (Reqs.Num() == 0)
-	{
-		return false;
-	}
-
-	const UKeyringComponent* Keyring =
-		Interactor ? Interactor->FindComponentByClass<UKeyringComponent>() : nullptr;
 
-	return InteractionUtils::BuildMissingMessages(Reqs, Keyring, OutMissingMessages);
+	return InteractionUtils::GetMissingRequirementMessages(CurrentState, Interactor, OutMissingMessages);
 }
 
 
@@ -142,4 +255,216 @@ bool AInteractableActorBase::CacheStateFromId(FName StateId)
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+void AInteractableActorBase::InitializeSlots()
+{
+	SlotStateIndices.Reset();
+	SlotComponents.Reset();
+	SlotByComponent.Reset();
+	SlotByBone.Reset();
+
+	if (InteractionSlots.Num() == 0) return;
+
+	TInlineComponentArray<UPrimitiveComponent*> Primitives(this);
+
+	for (int32 SlotIndex = 0; SlotIndex < InteractionSlots.Num(); ++SlotIndex)
+	{
+		const FInteractionSlot& Slot = InteractionSlots[SlotIndex];
+		SlotStateIndices.Add(INDEX_NONE);
+		SlotComponents.AddDefaulted();
+
+		if (const UInteractionDataAsset* Data = GetSlotData(SlotIndex))
+		{
+			if (!SetSlotState(Slot.SlotName, Slot.InitialStateId) && !SetSlotState(Slot.SlotName, Data->GetDefaultStateId()))
+			{
+				UE_LOG(LogInteractionFramework, Warning, TEXT("%s: slot %s has no valid state."), *GetName(), *Slot.SlotName.ToString());
+			}
+		}
+
+		UPrimitiveComponent* const* Found = Primitives.FindByPredicate([&Slot](const UPrimitiveComponent* Primitive)
+		{
+			return Primitive->GetFName() == Slot.ComponentName;
+		});
+		if (!Found)
+		{
+			UE_LOG(LogInteractionFramework, Warning, TEXT("%s: slot %s is bound to missing component %s."),
+				*GetName(), *Slot.SlotName.ToString(), *Slot.ComponentName.ToString());
+			continue;
+		}
+
+		SlotComponents[SlotIndex] = *Found;
+		if (Slot.SocketName.IsNone())
+		{
+			SlotByComponent.Add(*Found, SlotIndex);
+		}
+		else
+		{
+			// Hits report bones, so sockets are stored under the bone they are attached to.
+			const USkinnedMeshComponent* Skinned = Cast<USkinnedMeshComponent>(*Found);
+			SlotByBone.Add(Skinned ? Skinned->GetSocketBoneName(Slot.SocketName) : Slot.SocketName, SlotIndex);
+		}
+	}
+}
+
+int32 AInteractableActorBase::GetInteractionItemForHit(const FHitResult& Hit) const
+{
+	if (!Hit.BoneName.IsNone())
+	{
+		if (const int32* SlotIndex = SlotByBone.Find(Hit.BoneName))
+		{
+			const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+			if (HitComponent && HitComponent->GetFName() == InteractionSlots[*SlotIndex].ComponentName)
+			{
+				return *SlotIndex;
+			}
+		}
+	}
+
+	const int32* SlotIndex = SlotByComponent.Find(Hit.GetComponent());
+	return SlotIndex ? *SlotIndex : INDEX_NONE;
+}
+
+int32 AInteractableActorBase::FindSlotIndex(FName SlotName) const
+{
+	return InteractionSlots.IndexOfByPredicate([SlotName](const FInteractionSlot& Slot)
+	{
+		return Slot.SlotName == SlotName;
+	});
+}
+
+const UInteractionDataAsset* AInteractableActorBase::GetSlotData(int32 SlotIndex) const
+{
+	if (!InteractionSlots.IsValidIndex(SlotIndex)) return nullptr;
+
+	const UInteractionDataAsset* SlotData = InteractionSlots[SlotIndex].InteractionData;
+	return SlotData ? SlotData : InteractionData.Get();
+}
+
+const FInteractionStateDefinition* AInteractableActorBase::GetSlotState(int32 SlotIndex) const
+{
+	const UInteractionDataAsset* Data = GetSlotData(SlotIndex);
+	if (!Data || !SlotStateIndices.IsValidIndex(SlotIndex)) return nullptr;
+
+	const int32 StateIndex = SlotStateIndices[SlotIndex];
+	return Data->States.IsValidIndex(StateIndex) ? &Data->States[StateIndex] : nullptr;
+}
+
+bool AInteractableActorBase::SetSlotState(FName SlotName, FName NewStateId)
+{
+	InitializeInteraction();
+
+	const int32 SlotIndex = FindSlotIndex(SlotName);
+	const UInteractionDataAsset* Data = GetSlotData(SlotIndex);
+	if (!Data || NewStateId.IsNone() || !SlotStateIndices.IsValidIndex(SlotIndex)) return false;
+
+	const int32 StateIndex = Data->FindStateIndexById(NewStateId);
+	if (StateIndex == INDEX_NONE || StateIndex > MAX_int16) return false;
+
+	SlotStateIndices[SlotIndex] = static_cast<int16>(StateIndex);
+	PushSlotNetState(SlotIndex);
+	return true;
+}
+
+FName AInteractableActorBase::GetSlotStateId(FName SlotName) const
+{
+	const FInteractionStateDefinition* State = GetSlotState(FindSlotIndex(SlotName));
+	return State ? State->StateId : NAME_None;
+}
+
+FInteractionQueryResult AInteractableActorBase::QueryInteractionItem(AActor* Interactor, int32 Item) const
+{
+	return InteractionUtils::BuildQueryResult(GetSlotData(Item), GetSlotState(Item), Interactor);
+}
+
+void AInteractableActorBase::InteractItem(AActor* Interactor, int32 Item)
+{
+	const FInteractionStateDefinition* State = GetSlotState(Item);
+	if (!State) return;
+
+	TArray<FText> Missing;
+	if (InteractionUtils::GetMissingRequirementMessages(*State, Interactor, Missing))
+	{
+		K2_OnSlotInteractUnavailable(Interactor, InteractionSlots[Item].SlotName, Missing);
+		return;
+	}
+
+	K2_OnSlotInteractAvailable(Interactor, InteractionSlots[Item].SlotName);
+}
+
+FName AInteractableActorBase::GetInteractionItemStateId(int32 Item) const
+{
+	const FInteractionStateDefinition* State = GetSlotState(Item);
+	return State ? State->StateId : NAME_None;
+}
+
+bool AInteractableActorBase::GetInteractionItemLocation(int32 Item, FVector& OutLocation) const
+{
+	if (!GetSlotState(Item) || !SlotComponents.IsValidIndex(Item)) return false;
+
+	const UPrimitiveComponent* Component = SlotComponents[Item].Get();
+	if (!Component) return false;
+
+	// No socket resolves to the component's own location.
+	OutLocation = Component->GetSocketLocation(InteractionSlots[Item].SocketName);
+	return true;
+}
+
+void AInteractableActorBase::PushNetState()
+{
+	if (!HasAuthority() || !InteractionData) return;
+
+	const int32 StateIndex = InteractionData->FindStateIndexById(CurrentStateId);
+	if (StateIndex > MAX_int16 || NetState.StateIndex == StateIndex) return;
+
+	NetState.StateIndex = static_cast<int16>(StateIndex);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AInteractableActorBase, NetState, this);
+	ForceNetUpdate();
+	InteractionNet::RecordChange();
+	UInteractionRegistrySubsystem::NotifyStateChanged(this);
+}
+
+void AInteractableActorBase::PushSlotNetState(int32 SlotIndex)
+{
+	if (!HasAuthority() || !SlotStateIndices.IsValidIndex(SlotIndex)) return;
+
+	SlotNetStates.SetNum(InteractionSlots.Num());
+	if (SlotNetStates[SlotIndex].StateIndex == SlotStateIndices[SlotIndex]) return;
+
+	SlotNetStates[SlotIndex].StateIndex = SlotStateIndices[SlotIndex];
+	MARK_PROPERTY_DIRTY_FROM_NAME(AInteractableActorBase, SlotNetStates, this);
+	ForceNetUpdate();
+	InteractionNet::RecordChange();
+	UInteractionRegistrySubsystem::NotifyStateChanged(this);
+}
+
+void AInteractableActorBase::RevertToReplicatedState()
+{
+	if (HasAuthority()) return;
+
+	OnRep_NetState();
+	OnRep_SlotNetStates();
+}
+
+void AInteractableActorBase::OnRep_NetState()
+{
+	// Replicated state wins over the authored one, whether or not deferred initialization ran yet.
+	InitializeInteraction();
+
+	if (!InteractionData || !InteractionData->States.IsValidIndex(NetState.StateIndex)) return;
+
+	const FName PreviousStateId = CurrentStateId;
+	CurrentState = InteractionData->States[NetState.StateIndex];
+	CurrentStateId = CurrentState.StateId;
+	TRACE_INTERACTION_STATE_CHANGED(this, PreviousStateId, CurrentStateId);
+}
+
+void AInteractableActorBase::OnRep_SlotNetStates()
+{
+	InitializeInteraction();
+
+	for (int32 SlotIndex = 0; SlotIndex < SlotNetStates.Num() && SlotStateIndices.IsValidIndex(SlotIndex); ++SlotIndex)
+	{
+		SlotStateIndices[SlotIndex] = SlotNetStates[SlotIndex].StateIndex;
+	}
+}
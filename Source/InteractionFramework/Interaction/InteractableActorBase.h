@@ -4,10 +4,43 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Interactable.h"
+#include "InteractionReplication.h"
 #include "Interaction/Data/InteractionDataAsset.h"
 #include "InteractableActorBase.generated.h"
 
 class UInteractionDataAsset;
+class UPrimitiveComponent;
+
+/**
+ * FInteractionSlot
+ *
+ * Named sub-part of an interactable actor (a drawer, a button) bound to one of its primitive components,
+ * optionally narrowed to a bone or socket of a skinned mesh. Each slot has its own state.
+ */
+USTRUCT(BlueprintType)
+struct FInteractionSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	FName SlotName = NAME_None;
+
+	/** Name of the primitive component whose hits resolve to this slot. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	FName ComponentName = NAME_None;
+
+	/** Optional bone or socket on ComponentName (skinned meshes), matched against the hit bone. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	FName SocketName = NAME_None;
+
+	/** Data for this slot. Null uses the actor's InteractionData. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	TObjectPtr<UInteractionDataAsset> InteractionData;
+
+	/** State to start in. None uses the data asset's default state. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	FName InitialStateId = NAME_None;
+};
 
 /**
  * AInteractableActorBase
@@ -17,6 +50,9 @@ class UInteractionDataAsset;
  * - Holds InteractionData data asset
  * - Creates a FInteractionQueryResult for the interactor InteractionComponent
  * - Sends interaction attempts to Blueprint hooks (available/unavailable)
+ * - Optional interaction slots: sub-parts resolved from the hit component, each with its own state.
+ *   Hits on components without a slot interact with the actor itself.
+ * - Replicates its state and slot states as data asset indices (push model, sent only when they change).
  */
 UCLASS(Abstract, BlueprintType)
 class INTERACTIONFRAMEWORK_API AInteractableActorBase
@@ -29,18 +65,63 @@ public:
 	AInteractableActorBase();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnConstruction(const FTransform& Transform) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+#endif
 
 	// IInteractable
 	virtual FInteractionQueryResult QueryInteraction_Implementation(AActor* Interactor) const override;
 	virtual void Interact_Implementation(AActor* Interactor) override;
+	virtual FName GetInteractionStateId() const override { return CurrentStateId; }
+	virtual void GetInteractionStateIds(TArray<FName>& OutStateIds) const override;
+	virtual bool ForceInteractionState(FName StateId) override { return SetInteractionState(StateId); }
+	virtual bool IsInteractionInitialized() const override { return bInteractionInitialized; }
+	virtual void InitializeInteraction() override;
+	virtual FGuid GetPersistentId() const override { return PersistentId; }
+	virtual const UObject* GetPersistentDataAsset() const override { return InteractionData; }
+	virtual bool GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const override;
+	virtual bool RestorePersistentState(int32 StateIndex, EInteractionPersistFlags Flags) override;
+	virtual int32 GetNumPersistentItems() const override { return InteractionSlots.Num(); }
+	virtual bool GetPersistentItemState(int32 Item, int32& OutStateIndex) const override;
+	virtual bool RestorePersistentItemState(int32 Item, int32 StateIndex) override;
+	virtual const UObject* GetPersistentItemDataAsset(int32 Item) const override { return GetSlotData(Item); }
+	virtual void RevertToReplicatedState() override;
+	virtual bool IsAvailableToAI() const override { return CurrentState.IsValid() && CurrentState.bAvailableToAI; }
+	virtual bool HasInteractionItems() const override { return InteractionSlots.Num() > 0; }
+	virtual int32 GetNumInteractionItems() const override { return InteractionSlots.Num(); }
+	virtual int32 GetInteractionItemForHit(const FHitResult& Hit) const override;
+	virtual FInteractionQueryResult QueryInteractionItem(AActor* Interactor, int32 Item) const override;
+	virtual void InteractItem(AActor* Interactor, int32 Item) override;
+	virtual FName GetInteractionItemStateId(int32 Item) const override;
+	virtual bool GetInteractionItemLocation(int32 Item, FVector& OutLocation) const override;
 
 	UFUNCTION(BlueprintCallable, Category="Interaction")
 	bool SetInteractionState(FName NewStateId);
+
+	UFUNCTION(BlueprintCallable, Category="Interaction|Slots")
+	bool SetSlotState(FName SlotName, FName NewStateId);
+
+	UFUNCTION(BlueprintPure, Category="Interaction|Slots")
+	FName GetSlotStateId(FName SlotName) const;
+
+	int32 FindSlotIndex(FName SlotName) const;
 	
 public:
 	/** Static configuration of this interaction. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interaction")
 	TObjectPtr<UInteractionDataAsset> InteractionData;
+
+	/** Stable id of a placed interactable, used to keep its state across streaming. Assigned in the editor. */
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, BlueprintReadOnly, Category="Interaction|Persistence")
+	FGuid PersistentId;
+
+	/** Sub-parts with their own state, e.g. the drawers of a cabinet. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interaction|Slots")
+	TArray<FInteractionSlot> InteractionSlots;
 	
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
@@ -49,6 +130,17 @@ protected:
 	/** Copy of the current state. */
 	UPROPERTY(Transient)
 	FInteractionStateDefinition CurrentState;
+
+	/** Set once InitializeInteraction ran; initialization may be deferred past BeginPlay. */
+	bool bInteractionInitialized = false;
+
+	/** Index of CurrentState in InteractionData, written by the server. */
+	UPROPERTY(ReplicatedUsing=OnRep_NetState)
+	FInteractionNetState NetState;
+
+	/** Per-slot state indices, parallel to InteractionSlots, written by the server. */
+	UPROPERTY(ReplicatedUsing=OnRep_SlotNetStates)
+	TArray<FInteractionNetState> SlotNetStates;
 	
 protected:
 	void InitializeInteractionState();
@@ -61,10 +153,43 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, Category="Interaction")
 	void K2_OnInteractUnavailable(AActor* Interactor, const TArray<FText>& MissingMessages);
 
+	/** Called when a slot is interacted with and it is currently available. */
+	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|Slots")
+	void K2_OnSlotInteractAvailable(AActor* Interactor, FName SlotName);
+
+	/** Called when a slot is interacted with but it is currently unavailable. */
+	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|Slots")
+	void K2_OnSlotInteractUnavailable(AActor* Interactor, FName SlotName, const TArray<FText>& MissingMessages);
+
 	/** Helper to get a list of missing requirement messages for the given keyring. */
 	bool GetMissingRequirementMessages(AActor* Interactor, TArray<FText>& OutMissingMessages) const;
 
 	bool CacheStateFromId(FName StateId);
+
+	UFUNCTION()
+	void OnRep_NetState();
+
+	UFUNCTION()
+	void OnRep_SlotNetStates();
+
+	/** Server only: pushes the current state or a slot state to clients if it changed. */
+	void PushNetState();
+	void PushSlotNetState(int32 SlotIndex);
+
+	void InitializeSlots();
+	const UInteractionDataAsset* GetSlotData(int32 SlotIndex) const;
+	const FInteractionStateDefinition* GetSlotState(int32 SlotIndex) const;
+
+private:
+	/** Per-slot index into the slot's data asset states, parallel to InteractionSlots. */
+	TArray<int16> SlotStateIndices;
+
+	/** Component each slot is bound to, parallel to InteractionSlots. Null when the component is missing. */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> SlotComponents;
+
+	/** Precomputed hit lookup: component to slot, and bone to slot for socket-bound slots. */
+	TMap<TObjectKey<UPrimitiveComponent>, int32> SlotByComponent;
+	TMap<FName, int32> SlotByBone;
 	
 	static void LogCachedStateDefNull()
 	{
@@ -0,0 +1,242 @@
+
+#include "InteractableComponent.h"
+
+#include "InteractionFramework.h"
+#include "InteractionUtils.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractionPersistenceSubsystem.h"
+#include "Interaction/Data/InteractionDataAsset.h"
+#include "Interaction/Data/InteractionTypes.h"
+#include "Debug/InteractionTrace.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+UInteractableComponent::UInteractableComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	SetIsReplicatedByDefault(true);
+}
+
+void UInteractableComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UInteractableComponent, NetState, Params);
+}
+
+void UInteractableComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterInteractable(this);
+		Registry->RequestInitialization(this);
+	}
+	else
+	{
+		InitializeInteraction();
+	}
+}
+
+void UInteractableComponent::InitializeInteraction()
+{
+	if (bInteractionInitialized) return;
+
+	bInteractionInitialized = true;
+
+	const UInteractionPersistenceSubsystem* Persistence = GetOwnerRole() == ROLE_Authority ? UInteractionPersistenceSubsystem::Get(this) : nullptr;
+	if (!Persistence || !Persistence->Restore(*this))
+	{
+		InitializeInteractionState();
+	}
+}
+
+bool UInteractableComponent::GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const
+{
+	if (!bInteractionInitialized || StateIndex == INDEX_NONE) return false;
+
+	OutStateIndex = StateIndex;
+	OutFlags = EInteractionPersistFlags::None;
+	return true;
+}
+
+const UObject* UInteractableComponent::GetPersistentDataAsset() const
+{
+	return InteractionData;
+}
+
+bool UInteractableComponent::RestorePersistentState(int32 InStateIndex, EInteractionPersistFlags Flags)
+{
+	if (!InteractionData || !InteractionData->States.IsValidIndex(InStateIndex)) return false;
+
+	StateIndex = static_cast<int16>(InStateIndex);
+	PushNetState();
+	return true;
+}
+
+void UInteractableComponent::OnRegister()
+{
+	Super::OnRegister();
+
+#if WITH_EDITOR
+	UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, false);
+#endif
+}
+
+#if WITH_EDITOR
+
+void UInteractableComponent::PostEditImport()
+{
+	Super::PostEditImport();
+	UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, true);
+}
+
+void UInteractableComponent::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	if (!bDuplicateForPIE)
+	{
+		UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, true);
+	}
+}
+
+#endif
+
+void UInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this))
+	{
+		Persistence->Record(*this);
+	}
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterInteractable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UInteractableComponent::InitializeInteractionState()
+{
+	if (!InteractionData) return;
+
+	if (!SetInteractionState(InitialStateId))
+	{
+		if (!SetInteractionState(InteractionData->GetDefaultStateId()))
+		{
+			UE_LOG(LogInteractionFramework, Error, TEXT("%s has no valid interaction state."), *GetPathName());
+		}
+	}
+}
+
+const FInteractionStateDefinition* UInteractableComponent::GetCurrentState() const
+{
+	if (!InteractionData || !InteractionData->States.IsValidIndex(StateIndex)) return nullptr;
+
+	return &InteractionData->States[StateIndex];
+}
+
+bool UInteractableComponent::IsAvailableToAI() const
+{
+	const FInteractionStateDefinition* State = GetCurrentState();
+	return State && State->bAvailableToAI;
+}
+
+FName UInteractableComponent::GetInteractionStateId() const
+{
+	const FInteractionStateDefinition* State = GetCurrentState();
+	return State ? State->StateId : NAME_None;
+}
+
+void UInteractableComponent::GetInteractionStateIds(TArray<FName>& OutStateIds) const
+{
+	if (!InteractionData) return;
+
+	for (const FInteractionStateDefinition& State : InteractionData->States)
+	{
+		OutStateIds.Add(State.StateId);
+	}
+}
+
+bool UInteractableComponent::SetInteractionState(FName NewStateId)
+{
+	// State set before deferred initialization ran, e.g. from a Blueprint BeginPlay.
+	InitializeInteraction();
+
+	if (!InteractionData || NewStateId.IsNone()) return false;
+
+	const int32 NewIndex = InteractionData->FindStateIndexById(NewStateId);
+	if (NewIndex == INDEX_NONE || NewIndex > MAX_int16) return false;
+	if (NewIndex == StateIndex) return true;
+
+	const FName PreviousStateId = GetInteractionStateId();
+	StateIndex = static_cast<int16>(NewIndex);
+	TRACE_INTERACTION_STATE_CHANGED(GetOwner(), PreviousStateId, NewStateId);
+	PushNetState();
+	return true;
+}
+
+void UInteractableComponent::PushNetState()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority() || NetState.StateIndex == StateIndex) return;
+
+	NetState.StateIndex = StateIndex;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UInteractableComponent, NetState, this);
+	Owner->ForceNetUpdate();
+	InteractionNet::RecordChange();
+	UInteractionRegistrySubsystem::NotifyStateChanged(this);
+}
+
+void UInteractableComponent::OnRep_NetState()
+{
+	// Replicated state wins over the authored one, whether or not deferred initialization ran yet.
+	InitializeInteraction();
+
+	if (!InteractionData || !InteractionData->States.IsValidIndex(NetState.StateIndex)) return;
+
+	const FName PreviousStateId = GetInteractionStateId();
+	StateIndex = NetState.StateIndex;
+	TRACE_INTERACTION_STATE_CHANGED(GetOwner(), PreviousStateId, GetInteractionStateId());
+}
+
+void UInteractableComponent::RevertToReplicatedState()
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		OnRep_NetState();
+	}
+}
+
+bool UInteractableComponent::GetMissingRequirementMessages(AActor* Interactor, TArray<FText>& OutMissingMessages) const
+{
+	const FInteractionStateDefinition* State = GetCurrentState();
+	if (!State)
+	{
+		OutMissingMessages.Reset();
+		return false;
+	}
+
+	return InteractionUtils::GetMissingRequirementMessages(*State, Interactor, OutMissingMessages);
+}
+
+FInteractionQueryResult UInteractableComponent::QueryInteraction_Implementation(AActor* Interactor) const
+{
+	return InteractionUtils::BuildQueryResult(InteractionData, GetCurrentState(), Interactor);
+}
+
+void UInteractableComponent::Interact_Implementation(AActor* Interactor)
+{
+	if (!GetCurrentState()) return;
+
+	TArray<FText> Missing;
+	const bool bHasMissing = GetMissingRequirementMessages(Interactor, Missing);
+
+	OnInteracted.Broadcast(Interactor, !bHasMissing, Missing);
+}
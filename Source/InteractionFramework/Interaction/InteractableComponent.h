@@ -0,0 +1,106 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Interactable.h"
+#include "InteractionReplication.h"
+#include "InteractableComponent.generated.h"
+
+class UInteractionDataAsset;
+struct FInteractionStateDefinition;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnInteractableInteracted, AActor*, Interactor, bool, bAvailable, const TArray<FText>&, MissingMessages);
+
+/**
+ * UInteractableComponent
+ *
+ * Makes any actor interactable without inheriting from AInteractableActorBase, e.g. a plain static mesh actor
+ * already placed in a level. Owns the data asset reference, the current state (as an index into the data
+ * asset, not a copy of it) and the requirement evaluation against the interactor's keyring.
+ * Interact attempts are reported through OnInteracted instead of Blueprint events on the actor.
+ *
+ * The state index replicates (push model) when the owning actor replicates; placed static mesh actors
+ * need bReplicates enabled for clients to see state changes.
+ *
+ * Registers itself (not its owner) with the interaction registry. The instance is deliberately small:
+ * the footprint over UActorComponent is checked by the InteractionFramework.InteractableComponent.Footprint test.
+ */
+UCLASS(ClassGroup=(Interaction), meta=(BlueprintSpawnableComponent))
+class INTERACTIONFRAMEWORK_API UInteractableComponent
+	: public UActorComponent
+	, public IInteractable
+{
+	GENERATED_BODY()
+
+public:
+	UInteractableComponent();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnRegister() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+#endif
+
+	// IInteractable
+	virtual FInteractionQueryResult QueryInteraction_Implementation(AActor* Interactor) const override;
+	virtual void Interact_Implementation(AActor* Interactor) override;
+	virtual FName GetInteractionStateId() const override;
+	virtual void GetInteractionStateIds(TArray<FName>& OutStateIds) const override;
+	virtual bool ForceInteractionState(FName StateId) override { return SetInteractionState(StateId); }
+	virtual bool IsInteractionInitialized() const override { return bInteractionInitialized; }
+	virtual void InitializeInteraction() override;
+	virtual FGuid GetPersistentId() const override { return PersistentId; }
+	virtual const UObject* GetPersistentDataAsset() const override;
+	virtual bool GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const override;
+	virtual bool RestorePersistentState(int32 InStateIndex, EInteractionPersistFlags Flags) override;
+	virtual void RevertToReplicatedState() override;
+	virtual bool IsAvailableToAI() const override;
+
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	bool SetInteractionState(FName NewStateId);
+
+	/** Current state definition inside InteractionData, null before BeginPlay or without data. */
+	const FInteractionStateDefinition* GetCurrentState() const;
+
+	/** Fills the messages of the current state's requirements the interactor's keyring does not meet. */
+	bool GetMissingRequirementMessages(AActor* Interactor, TArray<FText>& OutMissingMessages) const;
+
+public:
+	/** Static configuration of this interaction. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	TObjectPtr<UInteractionDataAsset> InteractionData;
+
+	/** State to start in. None (or unknown) uses the data asset's default state. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	FName InitialStateId = NAME_None;
+
+	/** Stable id of a placed interactable, used to keep its state across streaming. Assigned in the editor. */
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, BlueprintReadOnly, Category="Interaction|Persistence")
+	FGuid PersistentId;
+
+	/** Interact() was invoked, bAvailable is false when requirements were missing. */
+	UPROPERTY(BlueprintAssignable, Category="Interaction")
+	FOnInteractableInteracted OnInteracted;
+
+private:
+	/** Index into InteractionData->States, INDEX_NONE when there is no valid state. */
+	int16 StateIndex = INDEX_NONE;
+
+	/** StateIndex as last written by the server. Kept apart so predicted changes can be reverted. */
+	UPROPERTY(ReplicatedUsing=OnRep_NetState)
+	FInteractionNetState NetState;
+
+	bool bInteractionInitialized = false;
+
+	void InitializeInteractionState();
+
+	/** Server only: pushes StateIndex to clients if it changed. */
+	void PushNetState();
+
+	UFUNCTION()
+	void OnRep_NetState();
+};
@@ -0,0 +1,348 @@
+
+#include "InteractableInstancedComponent.h"
+
+#include "InteractionPersistenceSubsystem.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractionUtils.h"
+#include "Interaction/Data/InteractionDataAsset.h"
+#include "Interaction/Data/InteractionTypes.h"
+#include "InteractionReplication.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+UInteractableInstancedComponent::UInteractableInstancedComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SetIsReplicatedByDefault(true);
+}
+
+void UInteractableInstancedComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UInteractableInstancedComponent, NetInstanceStates, Params);
+}
+
+void UInteractableInstancedComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Clients get nothing recorded; restored states reach them through NetInstanceStates.
+	if (const UInteractionPersistenceSubsystem* Persistence = GetOwnerRole() == ROLE_Authority ? UInteractionPersistenceSubsystem::Get(this) : nullptr)
+	{
+		Persistence->Restore(*this);
+	}
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterInteractable(this);
+	}
+}
+
+void UInteractableInstancedComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this))
+	{
+		Persistence->Record(*this);
+	}
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterInteractable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UInteractableInstancedComponent::OnRegister()
+{
+	Super::OnRegister();
+
+#if WITH_EDITOR
+	UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, false);
+#endif
+}
+
+#if WITH_EDITOR
+
+void UInteractableInstancedComponent::PostEditImport()
+{
+	Super::PostEditImport();
+	UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, true);
+}
+
+void UInteractableInstancedComponent::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	if (!bDuplicateForPIE)
+	{
+		UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, true);
+	}
+}
+
+#endif
+
+bool UInteractableInstancedComponent::RemoveInstance(int32 InstanceIndex)
+{
+	if (!Super::RemoveInstance(InstanceIndex)) return false;
+
+	RemoveInstanceState(InstanceIndex);
+	return true;
+}
+
+bool UInteractableInstancedComponent::RemoveInstances(const TArray<int32>& InstancesToRemove)
+{
+	// The base removes highest index first, mirror that so swaps land on the same slots.
+	TArray<int32> SortedInstances = InstancesToRemove;
+	SortedInstances.Sort(TGreater<int32>());
+
+	if (!Super::RemoveInstances(InstancesToRemove)) return false;
+
+	for (const int32 InstanceIndex : SortedInstances)
+	{
+		RemoveInstanceState(InstanceIndex);
+	}
+	return true;
+}
+
+void UInteractableInstancedComponent::ClearInstances()
+{
+	Super::ClearInstances();
+	InstanceStates.Reset();
+	PushNetInstanceStates();
+}
+
+void UInteractableInstancedComponent::RemoveInstanceState(int32 InstanceIndex)
+{
+	if (!InstanceStates.IsValidIndex(InstanceIndex)) return;
+
+	if (bSupportRemoveAtSwap)
+	{
+		InstanceStates.RemoveAtSwap(InstanceIndex, EAllowShrinking::No);
+	}
+	else
+	{
+		InstanceStates.RemoveAt(InstanceIndex, EAllowShrinking::No);
+	}
+	PushNetInstanceStates();
+}
+
+void UInteractableInstancedComponent::SyncInstanceStates() const
+{
+	const int32 NumInstances = GetInstanceCount();
+	if (InstanceStates.Num() == NumInstances) return;
+
+	const int32 OldNum = InstanceStates.Num();
+	InstanceStates.SetNum(NumInstances, EAllowShrinking::No);
+
+	const uint8 DefaultIndex = GetDefaultStateIndex();
+	for (int32 i = OldNum; i < NumInstances; ++i)
+	{
+		InstanceStates[i].StateIndex = DefaultIndex;
+	}
+}
+
+uint8 UInteractableInstancedComponent::GetDefaultStateIndex() const
+{
+	if (!InteractionData) return 0;
+
+	const FName DefaultStateId = InteractionData->GetDefaultStateId();
+	const int32 Index = InteractionData->FindStateIndexById(DefaultStateId);
+	if (Index == INDEX_NONE) return 0;
+	if (!ensureMsgf(Index <= MAX_uint8, TEXT("%s: default state '%s' of %s is not addressable by a packed instance state."),
+		*GetPathName(), *DefaultStateId.ToString(), *GetNameSafe(InteractionData)))
+	{
+		return 0;
+	}
+	return static_cast<uint8>(Index);
+}
+
+const FInteractionStateDefinition* UInteractableInstancedComponent::GetInstanceState(int32 InstanceIndex) const
+{
+	if (!InteractionData || !IsValidInstance(InstanceIndex)) return nullptr;
+
+	SyncInstanceStates();
+	const FInstanceState& State = InstanceStates[InstanceIndex];
+	if (State.Flags & Flag_Disabled) return nullptr;
+
+	return InteractionData->States.IsValidIndex(State.StateIndex) ? &InteractionData->States[State.StateIndex] : nullptr;
+}
+
+bool UInteractableInstancedComponent::SetInstanceState(int32 InstanceIndex, FName NewStateId)
+{
+	if (!InteractionData || !IsValidInstance(InstanceIndex) || NewStateId.IsNone()) return false;
+
+	const int32 StateIndex = InteractionData->FindStateIndexById(NewStateId);
+	if (StateIndex == INDEX_NONE || StateIndex > MAX_uint8) return false;
+
+	SyncInstanceStates();
+	InstanceStates[InstanceIndex].StateIndex = static_cast<uint8>(StateIndex);
+	PushNetInstanceStates();
+	return true;
+}
+
+FName UInteractableInstancedComponent::GetInstanceStateId(int32 InstanceIndex) const
+{
+	if (!InteractionData || !IsValidInstance(InstanceIndex)) return NAME_None;
+
+	SyncInstanceStates();
+	const int32 StateIndex = InstanceStates[InstanceIndex].StateIndex;
+	return InteractionData->States.IsValidIndex(StateIndex) ? InteractionData->States[StateIndex].StateId : NAME_None;
+}
+
+void UInteractableInstancedComponent::SetInstanceInteractionEnabled(int32 InstanceIndex, bool bEnabled)
+{
+	if (!IsValidInstance(InstanceIndex)) return;
+
+	SyncInstanceStates();
+	uint8& Flags = InstanceStates[InstanceIndex].Flags;
+	Flags = bEnabled ? (Flags & ~Flag_Disabled) : (Flags | Flag_Disabled);
+	PushNetInstanceStates();
+}
+
+bool UInteractableInstancedComponent::IsInstanceInteractionEnabled(int32 InstanceIndex) const
+{
+	if (!IsValidInstance(InstanceIndex)) return false;
+
+	SyncInstanceStates();
+	return !(InstanceStates[InstanceIndex].Flags & Flag_Disabled);
+}
+
+FInteractionQueryResult UInteractableInstancedComponent::QueryInteraction_Implementation(AActor* Interactor) const
+{
+	// The component as a whole has no prompt, only its instances do.
+	FInteractionQueryResult Result{};
+	Result.bShouldShowPrompt = false;
+	return Result;
+}
+
+void UInteractableInstancedComponent::GetInteractionStateIds(TArray<FName>& OutStateIds) const
+{
+	if (!InteractionData) return;
+
+	for (const FInteractionStateDefinition& State : InteractionData->States)
+	{
+		OutStateIds.Add(State.StateId);
+	}
+}
+
+bool UInteractableInstancedComponent::ForceInteractionState(FName StateId)
+{
+	bool bAny = false;
+	for (int32 i = 0; i < GetInstanceCount(); ++i)
+	{
+		bAny |= SetInstanceState(i, StateId);
+	}
+	return bAny;
+}
+
+FInteractionQueryResult UInteractableInstancedComponent::QueryInteractionItem(AActor* Interactor, int32 Item) const
+{
+	return InteractionUtils::BuildQueryResult(InteractionData, GetInstanceState(Item), Interactor);
+}
+
+void UInteractableInstancedComponent::InteractItem(AActor* Interactor, int32 Item)
+{
+	const FInteractionStateDefinition* State = GetInstanceState(Item);
+	if (!State) return;
+
+	TArray<FText> Missing;
+	const bool bHasMissing = InteractionUtils::GetMissingRequirementMessages(*State, Interactor, Missing);
+
+	if (!bHasMissing)
+	{
+		if (const FName* NextStateId = StateTransitions.Find(State->StateId))
+		{
+			SetInstanceState(Item, *NextStateId);
+		}
+	}
+
+	OnInstanceInteracted.Broadcast(Item, Interactor, !bHasMissing);
+}
+
+FName UInteractableInstancedComponent::GetInteractionItemStateId(int32 Item) const
+{
+	// Disabled instances report None, so enabling or disabling one also counts as a change.
+	const FInteractionStateDefinition* State = GetInstanceState(Item);
+	return State ? State->StateId : NAME_None;
+}
+
+bool UInteractableInstancedComponent::GetInteractionItemLocation(int32 Item, FVector& OutLocation) const
+{
+	FTransform InstanceTransform;
+	if (!GetInstanceTransform(Item, InstanceTransform, /*bWorldSpace*/ true)) return false;
+
+	OutLocation = InstanceTransform.GetLocation();
+	return true;
+}
+
+bool UInteractableInstancedComponent::GetPersistentItemState(int32 Item, int32& OutStateIndex) const
+{
+	if (!InteractionData || !IsValidInstance(Item)) return false;
+
+	SyncInstanceStates();
+	OutStateIndex = InstanceStates[Item].StateIndex;
+	return true;
+}
+
+bool UInteractableInstancedComponent::RestorePersistentItemState(int32 Item, int32 StateIndex)
+{
+	if (!InteractionData || !InteractionData->States.IsValidIndex(StateIndex) || StateIndex > MAX_uint8 || !IsValidInstance(Item)) return false;
+
+	SyncInstanceStates();
+	InstanceStates[Item].StateIndex = static_cast<uint8>(StateIndex);
+	PushNetInstanceStates();
+	return true;
+}
+
+const UObject* UInteractableInstancedComponent::GetPersistentItemDataAsset(int32 Item) const
+{
+	return InteractionData;
+}
+
+void UInteractableInstancedComponent::RevertToReplicatedState()
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		OnRep_NetInstanceStates();
+	}
+}
+
+void UInteractableInstancedComponent::PushNetInstanceStates()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority()) return;
+
+	SyncInstanceStates();
+	bool bChanged = NetInstanceStates.Num() != InstanceStates.Num();
+	NetInstanceStates.SetNum(InstanceStates.Num(), EAllowShrinking::No);
+	for (int32 i = 0; i < InstanceStates.Num(); ++i)
+	{
+		const uint16 Packed = InstanceStates[i].StateIndex | (InstanceStates[i].Flags << 8);
+		bChanged |= NetInstanceStates[i] != Packed;
+		NetInstanceStates[i] = Packed;
+	}
+	if (!bChanged) return;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(UInteractableInstancedComponent, NetInstanceStates, this);
+	Owner->ForceNetUpdate();
+	InteractionNet::RecordChange();
+	UInteractionRegistrySubsystem::NotifyStateChanged(this);
+}
+
+void UInteractableInstancedComponent::OnRep_NetInstanceStates()
+{
+	// Instances the server has not sent yet fall back to the default state, which also drops a rejected prediction.
+	SyncInstanceStates();
+	const uint8 DefaultIndex = GetDefaultStateIndex();
+	for (int32 i = 0; i < InstanceStates.Num(); ++i)
+	{
+		const bool bReplicated = NetInstanceStates.IsValidIndex(i);
+		InstanceStates[i].StateIndex = bReplicated ? static_cast<uint8>(NetInstanceStates[i] & 0xFF) : DefaultIndex;
+		InstanceStates[i].Flags = bReplicated ? static_cast<uint8>(NetInstanceStates[i] >> 8) : 0;
+	}
+	UInteractionRegistrySubsystem::NotifyStateChanged(this);
+}
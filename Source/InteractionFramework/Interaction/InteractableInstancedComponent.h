@@ -0,0 +1,129 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Interactable.h"
+#include "InteractableInstancedComponent.generated.h"
+
+class UInteractionDataAsset;
+struct FInteractionStateDefinition;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnInstanceInteracted, int32, InstanceIndex, AActor*, Interactor, bool, bAvailable);
+
+/**
+ * UInteractableInstancedComponent
+ *
+ * Instanced static mesh where every instance is its own interactable (foliage-like pickups, switches, crates).
+ * No actor is spawned per object: instances share InteractionData and keep a packed state
+ * (state index + flags, 2 bytes) that is kept in step with the instance array.
+ * The interaction component focuses and interacts per instance using the trace hit's Item.
+ * Derives from the plain instanced mesh component; hierarchical (HISM) components are not supported.
+ * The server replicates the packed states; clients predicting an interact are reverted to them when rejected.
+ * Placed components persist one row per instance (by instance index) across streaming and save games.
+ */
+UCLASS(ClassGroup=(Interaction), meta=(BlueprintSpawnableComponent))
+class INTERACTIONFRAMEWORK_API UInteractableInstancedComponent
+	: public UInstancedStaticMeshComponent
+	, public IInteractable
+{
+	GENERATED_BODY()
+
+public:
+	UInteractableInstancedComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	// UActorComponent
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnRegister() override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+#endif
+
+	// UInstancedStaticMeshComponent
+	virtual bool RemoveInstance(int32 InstanceIndex) override;
+	virtual bool RemoveInstances(const TArray<int32>& InstancesToRemove) override;
+	virtual void ClearInstances() override;
+
+	// IInteractable
+	virtual FInteractionQueryResult QueryInteraction_Implementation(AActor* Interactor) const override;
+	virtual void GetInteractionStateIds(TArray<FName>& OutStateIds) const override;
+	virtual bool ForceInteractionState(FName StateId) override;
+	virtual bool HasInteractionItems() const override { return true; }
+	virtual int32 GetNumInteractionItems() const override { return GetInstanceCount(); }
+	virtual FInteractionQueryResult QueryInteractionItem(AActor* Interactor, int32 Item) const override;
+	virtual void InteractItem(AActor* Interactor, int32 Item) override;
+	virtual FName GetInteractionItemStateId(int32 Item) const override;
+	virtual bool GetInteractionItemLocation(int32 Item, FVector& OutLocation) const override;
+	virtual FGuid GetPersistentId() const override { return PersistentId; }
+	virtual int32 GetNumPersistentItems() const override { return GetInstanceCount(); }
+	virtual bool GetPersistentItemState(int32 Item, int32& OutStateIndex) const override;
+	virtual bool RestorePersistentItemState(int32 Item, int32 StateIndex) override;
+	virtual const UObject* GetPersistentItemDataAsset(int32 Item) const override;
+	virtual void RevertToReplicatedState() override;
+
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	bool SetInstanceState(int32 InstanceIndex, FName NewStateId);
+
+	UFUNCTION(BlueprintPure, Category="Interaction")
+	FName GetInstanceStateId(int32 InstanceIndex) const;
+
+	/** Disabled instances stay visible but are never focused or interacted with. */
+	UFUNCTION(BlueprintCallable, Category="Interaction")
+	void SetInstanceInteractionEnabled(int32 InstanceIndex, bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category="Interaction")
+	bool IsInstanceInteractionEnabled(int32 InstanceIndex) const;
+
+public:
+	/** Static configuration shared by all instances. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	TObjectPtr<UInteractionDataAsset> InteractionData;
+
+	/**
+	 * State an instance moves to after an interaction with all requirements met, keyed by its current state.
+	 * States without an entry stay as they are; OnInstanceInteracted fires either way.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction")
+	TMap<FName, FName> StateTransitions;
+
+	/** Stable id of a placed component, instance rows are derived from it. Assigned in the editor. */
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, BlueprintReadOnly, Category="Interaction|Persistence")
+	FGuid PersistentId;
+
+	/** Interact() was invoked on an instance, bAvailable is false when requirements were missing. */
+	UPROPERTY(BlueprintAssignable, Category="Interaction")
+	FOnInstanceInteracted OnInstanceInteracted;
+
+private:
+	/** InstanceStates packed as StateIndex | Flags << 8, written by the server. */
+	UPROPERTY(ReplicatedUsing=OnRep_NetInstanceStates)
+	TArray<uint16> NetInstanceStates;
+
+	UFUNCTION()
+	void OnRep_NetInstanceStates();
+
+	/** Server only: pushes the instance states to clients if any changed. */
+	void PushNetInstanceStates();
+
+	enum EInstanceFlags : uint8
+	{
+		Flag_Disabled = 1 << 0,
+	};
+
+	struct FInstanceState
+	{
+		uint8 StateIndex = 0;
+		uint8 Flags = 0;
+	};
+
+	/** Per-instance state, index-parallel to the instance array. Grown lazily for newly added instances. */
+	mutable TArray<FInstanceState> InstanceStates;
+
+	void SyncInstanceStates() const;
+	uint8 GetDefaultStateIndex() const;
+	const FInteractionStateDefinition* GetInstanceState(int32 InstanceIndex) const;
+	void RemoveInstanceState(int32 InstanceIndex);
+};
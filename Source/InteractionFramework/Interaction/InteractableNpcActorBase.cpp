@@ -1,8 +1,14 @@
 
 #include "InteractableNpcActorBase.h"
 #include "KeyringComponent.h"
+#include "InteractionUtils.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractionPersistenceSubsystem.h"
+#include "Debug/InteractionTrace.h"
 #include "NpcSpeechBubbleWidget.h"
 #include "Components/WidgetComponent.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 AInteractableNpcActorBase::AInteractableNpcActorBase()
 {
@@ -15,12 +21,113 @@ AInteractableNpcActorBase::AInteractableNpcActorBase()
 	SpeechBubbleComponent->SetWidgetSpace(EWidgetSpace::Screen); // always faces camera
 	SpeechBubbleComponent->SetDrawAtDesiredSize(true);
 	SpeechBubbleComponent->SetVisibility(false);
+
+	bReplicates = true;
+	SetNetUpdateFrequency(1.f);
+}
+
+void AInteractableNpcActorBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AInteractableNpcActorBase, NetState, Params);
 }
 
 void AInteractableNpcActorBase::BeginPlay()
 {
 	Super::BeginPlay();
-	InitializeNpcState();
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterInteractable(this);
+		Registry->RequestInitialization(this);
+	}
+	else
+	{
+		InitializeInteraction();
+	}
+}
+
+void AInteractableNpcActorBase::InitializeInteraction()
+{
+	if (bInteractionInitialized) return;
+
+	bInteractionInitialized = true;
+
+	const UInteractionPersistenceSubsystem* Persistence = HasAuthority() ? UInteractionPersistenceSubsystem::Get(this) : nullptr;
+	if (!Persistence || !Persistence->Restore(*this))
+	{
+		InitializeNpcState();
+	}
+}
+
+bool AInteractableNpcActorBase::GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const
+{
+	if (!bInteractionInitialized || !NpcData) return false;
+
+	const FName StateId = CurrentStateId;
+	OutStateIndex = NpcData->States.IndexOfByPredicate([StateId](const FNpcDialogueState& State)
+	{
+		return State.StateId == StateId;
+	});
+	OutFlags = EInteractionPersistFlags::None;
+	return OutStateIndex != INDEX_NONE;
+}
+
+bool AInteractableNpcActorBase::RestorePersistentState(int32 StateIndex, EInteractionPersistFlags Flags)
+{
+	if (!NpcData || !NpcData->States.IsValidIndex(StateIndex)) return false;
+
+	CurrentState = NpcData->States[StateIndex];
+	CurrentStateId = CurrentState.StateId;
+	PushNetState();
+	return true;
+}
+
+void AInteractableNpcActorBase::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+#if WITH_EDITOR
+	UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, false);
+#endif
+}
+
+#if WITH_EDITOR
+
+void AInteractableNpcActorBase::PostEditImport()
+{
+	Super::PostEditImport();
+	UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, true);
+}
+
+void AInteractableNpcActorBase::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	if (!bDuplicateForPIE)
+	{
+		UInteractionPersistenceSubsystem::AssignPersistentId(PersistentId, this, true);
+	}
+}
+
+#endif
+
+void AInteractableNpcActorBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this))
+	{
+		Persistence->Record(*this);
+	}
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterInteractable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AInteractableNpcActorBase::InitializeNpcState()
@@ -41,8 +148,21 @@ void AInteractableNpcActorBase::InitializeNpcState()
 	}
 }
 
+void AInteractableNpcActorBase::GetInteractionStateIds(TArray<FName>& OutStateIds) const
+{
+	if (!NpcData) return;
+
+	for (const FNpcDialogueState& State : NpcData->States)
+	{
+		OutStateIds.Add(State.StateId);
+	}
+}
+
 bool AInteractableNpcActorBase::SetNpcState(FName NewStateId)
 {
+	// State set before deferred initialization ran, e.g. from a Blueprint BeginPlay.
+	InitializeInteraction();
+
 	if (!NpcData) return false;
 
 	if (!NewStateId.IsNone())
@@ -54,8 +174,11 @@ bool AInteractableNpcActorBase::SetNpcState(FName NewStateId)
 
 		if (!NpcData) return false; // Can not check if the provided new state id exists.
 
+		const FName PreviousStateId = CurrentStateId;
 		if (CacheStateFromId(NewStateId))
 		{
+			TRACE_INTERACTION_STATE_CHANGED(this, PreviousStateId, NewStateId);
+			PushNetState();
 			return true;
 		}
 	}
@@ -83,30 +206,15 @@ FInteractionQueryResult AInteractableNpcActorBase::QueryInteraction_Implementati
 
 int AInteractableNpcActorBase::GetMissingRequirements(AActor* Interactor) const
 {
-	int MissingNumber = 0;
-	if (!CurrentState.IsValid())
-	{
-		return false;
-	}
-	
-	const TArray<FInteractionKeyRequirement>& Reqs = CurrentState.RequiredKeys;
-	if (Reqs.Num() == 0)
+	if (!CurrentState.IsValid() || CurrentState.RequiredKeys.Num() == 0)
 	{
-		return false;
+		return 0;
 	}
 
 	const UKeyringComponent* Keyring =
 		Interactor ? Interactor->FindComponentByClass<UKeyringComponent>() : nullptr;
 
-	for (const FInteractionKeyRequirement& Req : Reqs)
-	{
-		if (!Req.KeyId.IsNone() && !(Keyring && Keyring->HasKey(Req.KeyId)))
-		{
-			MissingNumber++;
-		}
-	}
-
-	return MissingNumber;
+	return InteractionUtils::CountMissingRequirements(CurrentState.RequiredKeys, Keyring);
 }
 
 void AInteractableNpcActorBase::Interact_Implementation(AActor* Interactor)
@@ -136,10 +244,29 @@ void AInteractableNpcActorBase::Interact_Implementation(AActor* Interactor)
 	}
 }
 
-void AInteractableNpcActorBase::ShowBubble(const FText& Line, float Duration)
+void AInteractableNpcActorBase::OnInteractionLodChanged(EInteractionLodTier NewTier)
 {
+	const bool bSuppress = NewTier != EInteractionLodTier::Near;
+	if (bSuppress == bBubbleSuppressed) return;
+
+	bBubbleSuppressed = bSuppress;
 	if (!SpeechBubbleComponent) return;
 
+	if (bSuppress)
+	{
+		HideBubble();
+		SpeechBubbleComponent->Deactivate();
+	}
+	else
+	{
+		SpeechBubbleComponent->Activate();
+	}
+}
+
+void AInteractableNpcActorBase::ShowBubble(const FText& Line, float Duration)
+{
+	if (!SpeechBubbleComponent || bBubbleSuppressed) return;
+
 	if (UNpcSpeechBubbleWidget* W = Cast<UNpcSpeechBubbleWidget>(SpeechBubbleComponent->GetUserWidgetObject()))
 	{
 		W->SetLineText(Line);
@@ -192,4 +319,41 @@ bool AInteractableNpcActorBase::CacheStateFromId(FName StateId)
 	}
 
 	return false;
+}
+
+void AInteractableNpcActorBase::PushNetState()
+{
+	if (!HasAuthority() || !NpcData) return;
+
+	const FName StateId = CurrentStateId;
+	const int32 StateIndex = NpcData->States.IndexOfByPredicate([StateId](const FNpcDialogueState& State)
+	{
+		return State.StateId == StateId;
+	});
+	if (StateIndex > MAX_int16 || NetState.StateIndex == StateIndex) return;
+
+	NetState.StateIndex = static_cast<int16>(StateIndex);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AInteractableNpcActorBase, NetState, this);
+	ForceNetUpdate();
+	InteractionNet::RecordChange();
+}
+
+void AInteractableNpcActorBase::RevertToReplicatedState()
+{
+	if (!HasAuthority())
+	{
+		OnRep_NetState();
+	}
+}
+
+void AInteractableNpcActorBase::OnRep_NetState()
+{
+	InitializeInteraction();
+
+	if (!NpcData || !NpcData->States.IsValidIndex(NetState.StateIndex)) return;
+
+	const FName PreviousStateId = CurrentStateId;
+	CurrentState = NpcData->States[NetState.StateIndex];
+	CurrentStateId = CurrentState.StateId;
+	TRACE_INTERACTION_STATE_CHANGED(this, PreviousStateId, CurrentStateId);
 }
\ No newline at end of file
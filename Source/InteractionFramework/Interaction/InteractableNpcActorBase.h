@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Interactable.h"
+#include "InteractionReplication.h"
 #include "Interaction/Data/NpcInteractionDataAsset.h"
 #include "InteractableNpcActorBase.generated.h"
 
@@ -36,6 +37,10 @@ protected:
 	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category="NPC")
 	FName CurrentStateId = NAME_None;
 
+	/** Stable id of a placed NPC, used to keep its state across streaming. Assigned in the editor. */
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, BlueprintReadOnly, Category="NPC|Persistence")
+	FGuid PersistentId;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="NPC|UI")
 	TObjectPtr<UWidgetComponent> SpeechBubbleComponent = nullptr;
 
@@ -44,17 +49,53 @@ protected:
 
 	FTimerHandle BubbleHideTimer;
 
+	/** Set outside the Near tier: the bubble is hidden and its component stops ticking. */
+	bool bBubbleSuppressed = false;
+
+	/** Set once InitializeInteraction ran; initialization may be deferred past BeginPlay. */
+	bool bInteractionInitialized = false;
+
+	/** Index of CurrentState in NpcData, written by the server (push model). */
+	UPROPERTY(ReplicatedUsing=OnRep_NetState)
+	FInteractionNetState NetState;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnConstruction(const FTransform& Transform) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+#endif
 
 	// Interface
 	virtual FInteractionQueryResult QueryInteraction_Implementation(AActor* Interactor) const override;
 	virtual void Interact_Implementation(AActor* Interactor) override;
+	virtual FName GetInteractionStateId() const override { return CurrentStateId; }
+	virtual void GetInteractionStateIds(TArray<FName>& OutStateIds) const override;
+	virtual bool ForceInteractionState(FName StateId) override { return SetNpcState(StateId); }
+	virtual bool IsInteractionInitialized() const override { return bInteractionInitialized; }
+	virtual void InitializeInteraction() override;
+	virtual FGuid GetPersistentId() const override { return PersistentId; }
+	virtual const UObject* GetPersistentDataAsset() const override { return NpcData; }
+	/** NPC dialogue is for players; NPCs are never exposed to AI as smart objects. */
+	virtual bool IsAvailableToAI() const override { return false; }
+	virtual bool GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const override;
+	virtual bool RestorePersistentState(int32 StateIndex, EInteractionPersistFlags Flags) override;
+	virtual void RevertToReplicatedState() override;
+	virtual void OnInteractionLodChanged(EInteractionLodTier NewTier) override;
 
 	void InitializeNpcState();
 	bool CacheStateFromId(FName StateId);
 	int GetMissingRequirements(AActor* Interactor) const;
 
+	UFUNCTION()
+	void OnRep_NetState();
+
+	/** Server only: pushes the current state to clients if it changed. */
+	void PushNetState();
+
 	void ShowBubble(const FText& Line, float Duration);
 	void HideBubble();
 	
@@ -0,0 +1,192 @@
+
+#include "InteractablePickupActor.h"
+
+#include "KeyringComponent.h"
+#include "InteractionPickupPoolSubsystem.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractionPersistenceSubsystem.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+AInteractablePickupActor::AInteractablePickupActor()
+{
+	// Pool respawns move the pickup on the server.
+	SetReplicatingMovement(true);
+}
+
+void AInteractablePickupActor::BeginPlay()
+{
+	SpawnStateId = CurrentStateId;
+
+	Super::BeginPlay();
+}
+
+void AInteractablePickupActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AInteractablePickupActor, bNetPooled, Params);
+}
+
+void AInteractablePickupActor::Interact_Implementation(AActor* Interactor)
+{
+	if (bPooled) return;
+
+	if (!InteractionData || !CurrentState.IsValid())
+	{
+		LogCachedStateDefNull();
+		return;
+	}
+
+	TArray<FText> Missing;
+	if (GetMissingRequirementMessages(Interactor, Missing))
+	{
+		K2_OnInteractUnavailable(Interactor, Missing);
+		return;
+	}
+
+	if (UKeyringComponent* Keyring = Interactor ? Interactor->FindComponentByClass<UKeyringComponent>() : nullptr)
+	{
+		for (const FName KeyId : GrantedKeys)
+		{
+			Keyring->AddKey(KeyId);
+		}
+	}
+
+	K2_OnInteractAvailable(Interactor);
+	Consume();
+}
+
+bool AInteractablePickupActor::GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const
+{
+	if (!Super::GetPersistentState(OutStateIndex, OutFlags)) return false;
+
+	if (bPooled)
+	{
+		OutFlags |= EInteractionPersistFlags::Consumed;
+	}
+	return true;
+}
+
+bool AInteractablePickupActor::RestorePersistentState(int32 StateIndex, EInteractionPersistFlags Flags)
+{
+	if (EnumHasAnyFlags(Flags, EInteractionPersistFlags::Consumed))
+	{
+		// Picked up before this pickup streamed out: straight back to the pool.
+		Super::RestorePersistentState(StateIndex, Flags);
+		Consume();
+		return true;
+	}
+
+	return Super::RestorePersistentState(StateIndex, Flags);
+}
+
+void AInteractablePickupActor::Consume()
+{
+	if (bPooled) return;
+
+	// Predicted on a client: only hide it, the server pools or destroys it.
+	if (!HasAuthority())
+	{
+		DeactivateToPool();
+		return;
+	}
+
+	// Destroyed pickups are not asked for their state again.
+	if (UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this))
+	{
+		Persistence->AddFlags(PersistentId, EInteractionPersistFlags::Consumed);
+	}
+
+	UInteractionPickupPoolSubsystem* Pool = UInteractionPickupPoolSubsystem::Get(this);
+	if (!Pool || !Pool->ReleasePickup(this))
+	{
+		Destroy();
+	}
+}
+
+void AInteractablePickupActor::DeactivateToPool()
+{
+	bPooled = true;
+	PushNetPooled();
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterInteractable(this);
+	}
+
+	K2_OnPooled();
+}
+
+void AInteractablePickupActor::ActivateFromPool(const FTransform& Transform, bool bAsNewSpawn)
+{
+	bPooled = false;
+	PushNetPooled();
+
+	if (bAsNewSpawn)
+	{
+		PersistentId.Invalidate();
+	}
+	else if (UInteractionPersistenceSubsystem* Persistence = HasAuthority() ? UInteractionPersistenceSubsystem::Get(this) : nullptr)
+	{
+		// Clients only mirror the server's bNetPooled; the table is the server's.
+		Persistence->RemoveFlags(PersistentId, EInteractionPersistFlags::Consumed);
+	}
+
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+
+	// Same path as a fresh spawn: back to the spawn state, then into the registry.
+	CurrentStateId = SpawnStateId;
+	CurrentState = FInteractionStateDefinition{};
+	InitializeInteractionState();
+	bInteractionInitialized = true;
+
+	K2_OnRespawned();
+
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterInteractable(this);
+	}
+}
+
+void AInteractablePickupActor::PushNetPooled()
+{
+	if (!HasAuthority() || bNetPooled == bPooled) return;
+
+	bNetPooled = bPooled;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AInteractablePickupActor, bNetPooled, this);
+	ForceNetUpdate();
+	InteractionNet::RecordChange();
+}
+
+void AInteractablePickupActor::OnRep_NetPooled()
+{
+	if (bNetPooled == bPooled) return;
+
+	if (bNetPooled)
+	{
+		DeactivateToPool();
+	}
+	else
+	{
+		ActivateFromPool(GetActorTransform());
+	}
+}
+
+void AInteractablePickupActor::RevertToReplicatedState()
+{
+	if (HasAuthority()) return;
+
+	// Un-hide first: activating resets the state, which the base then reverts.
+	OnRep_NetPooled();
+	Super::RevertToReplicatedState();
+}
@@ -0,0 +1,81 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InteractableActorBase.h"
+#include "InteractablePickupActor.generated.h"
+
+/**
+ * AInteractablePickupActor
+ *
+ * Interactable that grants keys to the interactor's keyring and is then consumed.
+ * Consumed pickups go back to the world's UInteractionPickupPoolSubsystem (hidden, no collision, unregistered)
+ * instead of being destroyed, and respawns reuse them through AcquirePickup, which re-runs InitializeInteractionState.
+ * Only when the class pool is full is the pickup destroyed.
+ *
+ * Clients predicting a pickup only hide it; the server pools it and replicates that, or the prediction is reverted.
+ */
+UCLASS(Abstract, Blueprintable)
+class INTERACTIONFRAMEWORK_API AInteractablePickupActor : public AInteractableActorBase
+{
+	GENERATED_BODY()
+
+public:
+	AInteractablePickupActor();
+
+	virtual void BeginPlay() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// IInteractable
+	virtual void Interact_Implementation(AActor* Interactor) override;
+	virtual bool GetPersistentState(int32& OutStateIndex, EInteractionPersistFlags& OutFlags) const override;
+	virtual bool RestorePersistentState(int32 StateIndex, EInteractionPersistFlags Flags) override;
+	virtual void RevertToReplicatedState() override;
+
+	/** Returns the pickup to its pool, or destroys it when the pool is full. */
+	UFUNCTION(BlueprintCallable, Category="Interaction|Pickup")
+	void Consume();
+
+	UFUNCTION(BlueprintPure, Category="Interaction|Pickup")
+	bool IsPooled() const { return bPooled; }
+
+	/**
+	 * Called by the pool subsystem. bAsNewSpawn reuses the pickup for a runtime spawn: it drops its PersistentId,
+	 * so a placed pickup's row stays consumed instead of following the actor to its new location.
+	 */
+	void ActivateFromPool(const FTransform& Transform, bool bAsNewSpawn = false);
+	void DeactivateToPool();
+
+public:
+	/** Keys added to the interactor's keyring on a successful interaction. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Interaction|Pickup")
+	TArray<FName> GrantedKeys;
+
+	/** Max pooled instances of this class. Negative uses Interaction.PickupPool.MaxPerClass, 0 disables pooling. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interaction|Pickup")
+	int32 PoolSize = INDEX_NONE;
+
+protected:
+	/** Called after a pooled pickup was placed back into the world, before it is visible to interactors. */
+	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|Pickup")
+	void K2_OnRespawned();
+
+	/** Called when the pickup was consumed and returned to its pool. */
+	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|Pickup")
+	void K2_OnPooled();
+
+private:
+	/** State the pickup started in, restored on every respawn. */
+	FName SpawnStateId = NAME_None;
+
+	bool bPooled = false;
+
+	/** bPooled as last written by the server. */
+	UPROPERTY(ReplicatedUsing=OnRep_NetPooled)
+	bool bNetPooled = false;
+
+	UFUNCTION()
+	void OnRep_NetPooled();
+
+	void PushNetPooled();
+};
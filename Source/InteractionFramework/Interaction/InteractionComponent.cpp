@@ -7,11 +7,39 @@
 #include "TimerManager.h"
 #include "Interactable.h"
 #include "Debug/InteractionDebugHelper.h"
+#include "Debug/InteractionWorldInspector.h"
+#include "InteractionStats.h"
+#include "InteractionRegistrySubsystem.h"
+#include "InteractableComponent.h"
+#include "KeyringComponent.h"
+#include "InteractionUtils.h"
+#include "Debug/InteractionTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+
+static TAutoConsoleVariable<bool> CVarFlightRecorderDumpOnFailure(
+	TEXT("Interaction.FlightRecorder.DumpOnFailure"),
+	true,
+	TEXT("Dump interaction flight recorders when an ensure fails or the game crashes."));
+
+static TAutoConsoleVariable<bool> CVarNetPredict(
+	TEXT("Interaction.Net.Predict"),
+	true,
+	TEXT("Clients run interactions locally before the server confirms them. When off they wait for replication."));
+
+static TAutoConsoleVariable<float> CVarNetRangeTolerance(
+	TEXT("Interaction.Net.RangeTolerance"),
+	150.f,
+	TEXT("Distance (cm) beyond the trace distance the server still accepts a client interact from, for movement in flight."));
 
 UInteractionComponent::UInteractionComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
 
+	// Server_Interact / Client_ConfirmInteract
+	SetIsReplicatedByDefault(true);
+
 	CachedQueryResult = FInteractionQueryResult{};
 	CachedQueryResult.bShouldShowPrompt = false;
 }
@@ -23,11 +51,22 @@ void UInteractionComponent::BeginPlay()
 	DebugHelper = NewObject<UInteractionDebugHelper>(this);
 	DebugHelper->Initialize(this);
 	DebugHelper->SetDrawTrace(bDebugDrawTrace);
-	DebugHelper->SetDrawDuration(DebugDrawDuration);
 	DebugHelper->SetEnabled(bDebugOverlayEnabled);
+
+	WorldInspector = NewObject<UInteractionWorldInspector>(this);
+	WorldInspector->Initialize(this);
+	WorldInspector->SetEnabled(bWorldInspectorEnabled);
 	
 	InteractorActor = GetOwner();
-	
+	InteractorKeyring = GetOwner() ? GetOwner()->FindComponentByClass<UKeyringComponent>() : nullptr;
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterInteractor(this);
+	}
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UInteractionComponent::HandleWorldPostActorTick);
+
 	StartFocusScan();
 }
 
@@ -38,10 +77,31 @@ void UInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		DebugHelper->SetEnabled(false);
 	}
 
+	if (WorldInspector)
+	{
+		WorldInspector->SetEnabled(false);
+	}
+
 	StopFocusScan();
 	ResetHold();
 	ClearFocus();
 
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterInteractor(this);
+	}
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+
+	FCoreDelegates::OnHandleSystemEnsure.Remove(EnsureHandle);
+	FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+	EnsureHandle.Reset();
+	SystemErrorHandle.Reset();
+	PendingFrameDelta = FInteractionFrameDelta{};
+	PendingPredictions.Reset();
+	PendingConfirmations.Reset();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -54,6 +114,15 @@ float UInteractionComponent::GetHoldProgress() const
 	return FMath::Clamp(HoldElapsed / HoldDuration, 0.f, 1.f);
 }
 
+int32 UInteractionComponent::GetNumActiveTimers() const
+{
+	const UWorld* World = GetWorld();
+	if (!World) return 0;
+
+	const FTimerManager& TimerManager = World->GetTimerManager();
+	return (TimerManager.IsTimerActive(FocusScanTimer) ? 1 : 0) + (TimerManager.IsTimerActive(HoldTickTimer) ? 1 : 0);
+}
+
 void UInteractionComponent::StartFocusScan()
 {
 	if (!GetWorld()) return;
@@ -75,11 +144,20 @@ void UInteractionComponent::StopFocusScan()
 
 void UInteractionComponent::PerformFocusScan()
 {
-	if (!bEnabled) return;
+	// Remote players scan on their own machine and send what they interact with.
+	if (!bEnabled || !IsLocallyControlledInteractor()) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_InteractionFocusScan);
+	INC_DWORD_STAT(STAT_InteractionScans);
+	++NumFocusScans;
+	TRACE_INTERACTION_SCAN_BEGIN(InteractorActor.Get());
 	
 	AActor* NewActor = nullptr;
 	TScriptInterface<IInteractable> NewInteractable;
-	const bool bFound = FindInteractableInView(NewActor, NewInteractable);
+	int32 NewItem = INDEX_NONE;
+	const bool bFound = FindInteractableInView(NewActor, NewInteractable, NewItem);
+
+	TRACE_INTERACTION_SCAN_END(InteractorActor.Get(), NewActor);
 
 	// Lost focus
 	if (!bFound)
@@ -88,16 +166,25 @@ void UInteractionComponent::PerformFocusScan()
 		{
 			ClearFocus();
 		}
+
+		// The overlay redraws the last pushed trace every frame, so misses must be pushed as well.
+		DebugPushSnapshot();
+		RecordFlightSnapshot();
 		return;
 	}
 
 	// Focus changed
-	if (FocusedActor.Get() != NewActor)
+	if (FocusedActor.Get() != NewActor || FocusedObject.Get() != NewInteractable.GetObject() || FocusedItem != NewItem)
+	{
+		SetFocused(NewActor, NewInteractable, NewItem);
+	}
+	else if (IsCachedQueryStale())
 	{
-		SetFocused(NewActor, NewInteractable);
+		RefreshQuery();
 	}
 
 	DebugPushSnapshot();
+	RecordFlightSnapshot();
 }
 
 bool UInteractionComponent::GetViewPoint(FVector& OutViewLoc, FRotator& OutViewRot) const
@@ -127,11 +214,12 @@ bool UInteractionComponent::GetViewPoint(FVector& OutViewLoc, FRotator& OutViewR
 	return false;
 }
 
-bool UInteractionComponent::FindInteractableInView(AActor*& OutActor, TScriptInterface<IInteractable>& OutInteractable)
+bool UInteractionComponent::FindInteractableInView(AActor*& OutActor, TScriptInterface<IInteractable>& OutInteractable, int32& OutItem)
 
 {
 	OutActor = nullptr;
 	OutInteractable = nullptr;
+	OutItem = INDEX_NONE;
 
 	UWorld* World = GetWorld();
 	if (!World) return false;
@@ -147,7 +235,8 @@ bool UInteractionComponent::FindInteractableInView(AActor*& OutActor, TScriptInt
 	LastTraceEnd = End;
 	bLastTraceHit = false;
 	LastHitActor = nullptr;
-	LastHitResult = FHitResult();
+	LastHitImpactPoint = FVector::ZeroVector;
+	LastHitImpactNormal = FVector::ZeroVector;
 	bLastHitWasInteractable = false;
 
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(InteractionTrace), false);
@@ -159,21 +248,25 @@ bool UInteractionComponent::FindInteractableInView(AActor*& OutActor, TScriptInt
 	FHitResult Hit;
 	bool bHit = false;
 
-	if (TraceRadius <= 0.f)
 	{
-		bHit = World->LineTraceSingleByChannel(Hit, Start, End, TraceChannel, Params);
-	}
-	else
-	{
-		bHit = World->SweepSingleByChannel(
-			Hit,
-			Start,
-			End,
-			FQuat::Identity,
-			TraceChannel,
-			FCollisionShape::MakeSphere(TraceRadius),
-			Params
-		);
+		SCOPE_CYCLE_COUNTER(STAT_InteractionTrace);
+
+		if (TraceRadius <= 0.f)
+		{
+			bHit = World->LineTraceSingleByChannel(Hit, Start, End, TraceChannel, Params);
+		}
+		else
+		{
+			bHit = World->SweepSingleByChannel(
+				Hit,
+				Start,
+				End,
+				FQuat::Identity,
+				TraceChannel,
+				FCollisionShape::MakeSphere(TraceRadius),
+				Params
+			);
+		}
 	}
 
 	if (!bHit) return false;
@@ -181,42 +274,156 @@ bool UInteractionComponent::FindInteractableInView(AActor*& OutActor, TScriptInt
 	AActor* HitActor = Hit.GetActor();
 	if (!IsValid(HitActor)) return false;
 
-	if (!HitActor->GetClass()->ImplementsInterface(UInteractable::StaticClass())) return false;
+	TScriptInterface<IInteractable> HitInteractable;
+	int32 HitItem = INDEX_NONE;
+	bool bHitInteractable = ResolveInteractable(Hit, HitInteractable, HitItem);
+
+	// Far tier interactables are not focus candidates. Tiers follow the local players' views, so only they are filtered.
+	if (bHitInteractable && IsLocalPlayerInteractor())
+	{
+		const UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this);
+		bHitInteractable = !Registry || Registry->GetLodTier(HitInteractable.GetObject()) != EInteractionLodTier::Far;
+	}
+
+	TRACE_INTERACTION_HIT(InteractorActor.Get(), HitActor, bHitInteractable);
+
+	if (!bHitInteractable) return false;
 
 	bLastTraceHit = true;
 	LastHitActor = HitActor;
-	LastHitResult = Hit;
+	LastHitImpactPoint = Hit.ImpactPoint;
+	LastHitImpactNormal = Hit.ImpactNormal;
 	bLastHitWasInteractable = true;
 	
 	OutActor = HitActor;
-	
-	OutInteractable.SetObject(HitActor);
-	OutInteractable.SetInterface(Cast<IInteractable>(HitActor));
+	OutInteractable = HitInteractable;
+	OutItem = HitItem;
 	
 	return true;
 }
 
-void UInteractionComponent::SetFocused(AActor* NewActor, const TScriptInterface<IInteractable> NewInteractable)
+bool UInteractionComponent::ResolveInteractable(const FHitResult& Hit, TScriptInterface<IInteractable>& OutInteractable, int32& OutItem)
+{
+	OutItem = INDEX_NONE;
+
+	// Actor, or one of its slots (items) when the hit component is bound to one
+	AActor* HitActor = Hit.GetActor();
+	if (HitActor && HitActor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	{
+		IInteractable* Interactable = Cast<IInteractable>(HitActor);
+		if (Interactable && Interactable->HasInteractionItems())
+		{
+			OutItem = Interactable->GetInteractionItemForHit(Hit);
+		}
+
+		OutInteractable.SetObject(HitActor);
+		OutInteractable.SetInterface(Interactable);
+		return true;
+	}
+
+	// Interactable component, possibly made of items (instances)
+	UPrimitiveComponent* HitComponent = Hit.GetComponent();
+	if (HitComponent && HitComponent->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	{
+		IInteractable* Interactable = Cast<IInteractable>(HitComponent);
+		if (Interactable && Interactable->HasInteractionItems())
+		{
+			OutItem = Interactable->GetInteractionItemForHit(Hit);
+			if (OutItem == INDEX_NONE) return false;
+		}
+
+		OutInteractable.SetObject(HitComponent);
+		OutInteractable.SetInterface(Interactable);
+		return true;
+	}
+
+	// Actor made interactable by a component
+	if (UInteractableComponent* InteractableComponent = HitActor ? HitActor->FindComponentByClass<UInteractableComponent>() : nullptr)
+	{
+		OutInteractable.SetObject(InteractableComponent);
+		OutInteractable.SetInterface(InteractableComponent);
+		return true;
+	}
+
+	return false;
+}
+
+FInteractionQueryResult UInteractionComponent::QueryFocused(AActor* Interactor) const
+{
+	UObject* Target = FocusedObject.Get();
+	if (!Target)
+	{
+		return FInteractionQueryResult{};
+	}
+
+	if (FocusedItem != INDEX_NONE)
+	{
+		if (const IInteractable* Interactable = Cast<IInteractable>(Target))
+		{
+			return Interactable->QueryInteractionItem(Interactor, FocusedItem);
+		}
+	}
+
+	return IInteractable::Execute_QueryInteraction(Target, Interactor);
+}
+
+void UInteractionComponent::InteractFocused(AActor* Interactor)
+{
+	InteractTarget(FocusedObject.Get(), FocusedItem, Interactor);
+}
+
+void UInteractionComponent::InteractTarget(UObject* Target, int32 Item, AActor* Interactor)
 {
+	if (!Target) return;
+
+	if (Item != INDEX_NONE)
+	{
+		if (IInteractable* Interactable = Cast<IInteractable>(Target))
+		{
+			Interactable->InteractItem(Interactor, Item);
+		}
+		return;
+	}
+
+	IInteractable::Execute_Interact(Target, Interactor);
+}
+
+void UInteractionComponent::SetFocused(AActor* NewActor, const TScriptInterface<IInteractable> NewInteractable, int32 NewItem)
+{
+	INC_DWORD_STAT(STAT_InteractionFocusChanges);
+
 	ResetHold();
 
 	AActor* Prev = FocusedActor.Get();
+	const int32 PrevItem = FocusedItem;
 
-	if (IsValid(Prev) && Prev->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	if (bFocusHooksActive && IsValid(FocusedObject.Get()))
 	{
-		IInteractable::Execute_OnFocusEnd(Prev, InteractorActor.Get());
+		IInteractable::Execute_OnFocusEnd(FocusedObject.Get(), InteractorActor.Get());
 	}
+	bFocusHooksActive = false;
 	
 	FocusedActor = NewActor;
 	FocusedInteractable = NewInteractable;
+	FocusedObject = NewInteractable.GetObject();
+	FocusedItem = NewItem;
+
+	// Focused before its deferred initialization came up.
+	UInteractionRegistrySubsystem::EnsureInitialized(FocusedObject.Get());
 
-	if (IsValid(NewActor))
+	// BP cosmetic hooks only run for Near tier interactables.
+	if (IsValid(NewActor) && FocusedObject.IsValid())
 	{
-		IInteractable::Execute_OnFocusStart(NewActor, InteractorActor.Get());
+		const UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this);
+		if (!Registry || Registry->GetLodTier(FocusedObject.Get()) == EInteractionLodTier::Near)
+		{
+			IInteractable::Execute_OnFocusStart(FocusedObject.Get(), InteractorActor.Get());
+			bFocusHooksActive = true;
+		}
 	}
 	
 	RefreshQuery();
-	OnFocusChanged.Broadcast(NewActor, Prev);
+	BroadcastFocusChanged(NewActor, Prev, PrevItem);
 }
 
 void UInteractionComponent::ClearFocus()
@@ -224,30 +431,40 @@ void UInteractionComponent::ClearFocus()
 	ResetHold();
 
 	AActor* Prev = FocusedActor.Get();
+	const int32 PrevItem = FocusedItem;
 
-	if (IsValid(Prev) && Prev->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	if (IsValid(Prev))
 	{
-		IInteractable::Execute_OnFocusEnd(Prev, InteractorActor.Get());
+		INC_DWORD_STAT(STAT_InteractionFocusChanges);
+		if (bFocusHooksActive && IsValid(FocusedObject.Get()))
+		{
+			IInteractable::Execute_OnFocusEnd(FocusedObject.Get(), InteractorActor.Get());
+		}
 	}
+	bFocusHooksActive = false;
 	
 	FocusedActor = nullptr;
 	FocusedInteractable = nullptr;
+	FocusedObject = nullptr;
+	FocusedItem = INDEX_NONE;
 	
 	// Clear query for no prompt
 	CachedQueryResult = FInteractionQueryResult{};
 	CachedQueryResult.bShouldShowPrompt = false;
 
-	OnFocusChanged.Broadcast(nullptr, Prev);
-	OnQueryUpdated.Broadcast(CachedQueryResult);
+	BroadcastFocusChanged(nullptr, Prev, PrevItem);
+	BroadcastQueryUpdated();
 }
 
 void UInteractionComponent::RefreshQuery()
 {
+	SCOPE_CYCLE_COUNTER(STAT_InteractionRefreshQuery);
+
 	if (!FocusedActor.IsValid())
 	{
 		CachedQueryResult = FInteractionQueryResult{};
 		CachedQueryResult.bShouldShowPrompt = false;
-		OnQueryUpdated.Broadcast(CachedQueryResult);
+		BroadcastQueryUpdated();
 		DebugPushSnapshot();
 		return;
 	}
@@ -255,14 +472,26 @@ void UInteractionComponent::RefreshQuery()
 	AActor* Interactor = InteractorActor.Get();
 	AActor* Target = FocusedActor.Get();
 
-	if (!IsValid(Interactor) || !IsValid(Target))
+	if (!IsValid(Interactor) || !IsValid(Target) || !FocusedObject.IsValid())
 	{
 		ClearFocus();
 		return;
 	}
 
-	CachedQueryResult = IInteractable::Execute_QueryInteraction(Target, Interactor);
-	OnQueryUpdated.Broadcast(CachedQueryResult);
+	{
+		SCOPE_CYCLE_COUNTER(STAT_InteractionQueryInteraction);
+		INC_DWORD_STAT(STAT_InteractionQueries);
+		CachedQueryResult = QueryFocused(Interactor);
+	}
+
+	const IInteractable* Interactable = Cast<IInteractable>(FocusedObject.Get());
+	CachedQueryStateId = Interactable ? Interactable->GetInteractionStateId() : NAME_None;
+	CachedQueryItemStateId = Interactable && FocusedItem != INDEX_NONE ? Interactable->GetInteractionItemStateId(FocusedItem) : NAME_None;
+	CachedQueryKeyringRevision = InteractorKeyring.IsValid() ? InteractorKeyring->GetRevision() : 0;
+
+	TRACE_INTERACTION_QUERY(Interactor, Target, CachedQueryResult);
+
+	BroadcastQueryUpdated();
 }
 
 void UInteractionComponent::BeginInteract()
@@ -300,21 +529,179 @@ void UInteractionComponent::EndInteract()
 	}
 }
 
+bool UInteractionComponent::IsCachedQueryStale() const
+{
+	const IInteractable* Interactable = Cast<IInteractable>(FocusedObject.Get());
+	if (Interactable)
+	{
+		if (Interactable->GetInteractionStateId() != CachedQueryStateId) return true;
+
+		// Slots and instances change state independently of their owner.
+		if (FocusedItem != INDEX_NONE && Interactable->GetInteractionItemStateId(FocusedItem) != CachedQueryItemStateId) return true;
+	}
+
+	const UKeyringComponent* Keyring = InteractorKeyring.Get();
+	return Keyring && Keyring->GetRevision() != CachedQueryKeyringRevision;
+}
+
 void UInteractionComponent::ExecutePress()
 {
+	SCOPE_CYCLE_COUNTER(STAT_InteractionExecutePress);
+
 	if (!FocusedActor.IsValid()) return;
 
 	AActor* Interactor = InteractorActor.Get();
 	AActor* Target = FocusedActor.Get();
 
-	if (!IsValid(Interactor) || !IsValid(Target)) return;
+	if (!IsValid(Interactor) || !IsValid(Target) || !FocusedObject.IsValid()) return;
+
+	TRACE_INTERACTION_INTERACT(Interactor, Target);
 	
-	IInteractable::Execute_Interact(Target, Interactor);
+	if (IsPredictingClient())
+	{
+		PredictInteract(Interactor);
+	}
+	else
+	{
+		InteractFocused(Interactor);
+	}
+	++NumInteractsExecuted;
 
 	// Refresh to correct UI immediately after interaction.
 	RefreshQuery();
 }
 
+bool UInteractionComponent::IsLocalPlayerInteractor() const
+{
+	const APawn* Pawn = Cast<APawn>(InteractorActor.Get());
+	return Pawn && Pawn->IsLocallyControlled() && Pawn->IsPlayerControlled();
+}
+
+bool UInteractionComponent::IsLocallyControlledInteractor() const
+{
+	const APawn* Pawn = Cast<APawn>(InteractorActor.Get());
+	return !Pawn || GetNetMode() == NM_Standalone || Pawn->IsLocallyControlled();
+}
+
+void UInteractionComponent::PredictInteract(AActor* Interactor)
+{
+	FInteractionRequest Request;
+	Request.Target = FocusedObject.Get();
+	Request.Item = FocusedItem;
+
+	if (CVarNetPredict.GetValueOnGameThread())
+	{
+		if (++LastPredictionKey == 0)
+		{
+			++LastPredictionKey;
+		}
+		Request.PredictionKey = LastPredictionKey;
+		PendingPredictions.Add({ Request.PredictionKey, FocusedObject });
+		InteractionNet::RecordPrediction();
+
+		// Shown right away, reconciled when the server confirms.
+		InteractFocused(Interactor);
+	}
+
+	Server_Interact(Request);
+}
+
+bool UInteractionComponent::ValidateRequest(const FInteractionRequest& Request) const
+{
+	UObject* Target = Request.Target;
+	IInteractable* Interactable = IsValid(Target) ? Cast<IInteractable>(Target) : nullptr;
+	if (!Interactable) return false;
+
+	// Items (e.g. mesh instances) can be far from their object's origin, so range is checked against the item itself.
+	FVector TargetLocation = InteractionUtils::GetInteractableLocation(Target);
+	if (Request.Item != INDEX_NONE)
+	{
+		if (!Interactable->HasInteractionItems() || !Interactable->GetInteractionItemLocation(Request.Item, TargetLocation)) return false;
+	}
+
+	// The client traced from its own view; allow for the pawn having moved since.
+	FVector ViewLoc;
+	FRotator ViewRot;
+	if (!GetViewPoint(ViewLoc, ViewRot)) return false;
+
+	const float MaxDistance = TraceDistance + CVarNetRangeTolerance.GetValueOnGameThread();
+	return FVector::DistSquared(ViewLoc, TargetLocation) <= FMath::Square(MaxDistance);
+}
+
+void UInteractionComponent::Server_Interact_Implementation(const FInteractionRequest& Request)
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionExecutePress);
+
+	AActor* Interactor = InteractorActor.Get();
+	const bool bAccepted = IsValid(Interactor) && ValidateRequest(Request);
+
+	if (bAccepted)
+	{
+		UInteractionRegistrySubsystem::EnsureInitialized(Request.Target);
+		TRACE_INTERACTION_INTERACT(Interactor, InteractionUtils::GetInteractableActor(Request.Target));
+		InteractTarget(Request.Target, Request.Item, Interactor);
+	}
+	else
+	{
+		UE_LOG(LogInteractionFramework, Verbose, TEXT("%s: rejected interact with %s"), *GetNameSafe(Interactor), *GetNameSafe(Request.Target));
+	}
+
+	if (Request.PredictionKey == 0) return;
+
+	// Confirmed next frame, so the confirmation arrives after this frame's replicated results.
+	PendingConfirmations.Emplace(Request.PredictionKey, bAccepted);
+	if (PendingConfirmations.Num() == 1 && GetWorld())
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UInteractionComponent::FlushConfirmations);
+	}
+}
+
+void UInteractionComponent::FlushConfirmations()
+{
+	for (const TPair<uint16, bool>& Confirmation : PendingConfirmations)
+	{
+		Client_ConfirmInteract(Confirmation.Key, Confirmation.Value);
+	}
+	PendingConfirmations.Reset();
+}
+
+void UInteractionComponent::Client_ConfirmInteract_Implementation(uint16 PredictionKey, bool bAccepted)
+{
+	const int32 Index = PendingPredictions.IndexOfByPredicate([PredictionKey](const FPendingPrediction& Prediction)
+	{
+		return Prediction.PredictionKey == PredictionKey;
+	});
+	if (Index == INDEX_NONE) return;
+
+	const TWeakObjectPtr<UObject> Target = PendingPredictions[Index].Target;
+	PendingPredictions.RemoveAt(Index);
+
+	if (!bAccepted)
+	{
+		InteractionNet::RecordRejection();
+		UE_LOG(LogInteractionFramework, Verbose, TEXT("%s: interact with %s was rejected, reverting"), *GetNameSafe(GetOwner()), *GetNameSafe(Target.Get()));
+	}
+
+	// Whether accepted or not, the server's results are authoritative. Reverting to them waits until no other
+	// prediction is applied on top, or that one would be undone before its own confirmation.
+	const bool bTargetPending = PendingPredictions.ContainsByPredicate([&Target](const FPendingPrediction& Prediction)
+	{
+		return Prediction.Target == Target;
+	});
+
+	IInteractable* Interactable = Cast<IInteractable>(Target.Get());
+	if (Interactable && !bTargetPending)
+	{
+		Interactable->RevertToReplicatedState();
+	}
+
+	UKeyringComponent* Keyring = InteractorKeyring.Get();
+	if (Keyring && PendingPredictions.Num() == 0)
+	{
+		Keyring->RevertToReplicatedKeys();
+	}
+}
+
 void UInteractionComponent::BeginHold(float DurationSeconds)
 {
 	if (DurationSeconds <= 0.f)
@@ -338,8 +725,10 @@ void UInteractionComponent::BeginHold(float DurationSeconds)
 	);
 
 	DebugPushSnapshot();
+
+	TRACE_INTERACTION_HOLD(InteractorActor.Get(), FocusedActor.Get(), EInteractionTraceHoldEvent::Begin, 0.f);
 	
-	OnHoldProgress.Broadcast(0.f);
+	BroadcastHoldProgress(0.f);
 }
 
 void UInteractionComponent::TickHold()
@@ -358,7 +747,7 @@ void UInteractionComponent::TickHold()
 
 	HoldElapsed += HoldTickInterval;
 
-	OnHoldProgress.Broadcast(GetHoldProgress());
+	BroadcastHoldProgress(GetHoldProgress());
 
 	if (HoldElapsed >= HoldDuration)
 	{
@@ -375,11 +764,13 @@ void UInteractionComponent::CompleteHold()
 		return;
 	}
 
+	TRACE_INTERACTION_HOLD(InteractorActor.Get(), FocusedActor.Get(), EInteractionTraceHoldEvent::Complete, 1.f);
+
 	ResetHold();
 	
 	DebugPushSnapshot();
 	
-	OnHoldCompleted.Broadcast();
+	BroadcastHoldCompleted();
 
 	ExecutePress();
 }
@@ -391,6 +782,8 @@ void UInteractionComponent::ResetHold()
 		return;
 	}
 
+	TRACE_INTERACTION_HOLD(InteractorActor.Get(), FocusedActor.Get(), EInteractionTraceHoldEvent::Reset, GetHoldProgress());
+
 	bIsHolding = false;
 	HoldElapsed = 0.f;
 	HoldDuration = 0.f;
@@ -402,8 +795,114 @@ void UInteractionComponent::ResetHold()
 
 	DebugPushSnapshot();
 	
-	OnHoldProgress.Broadcast(0.f);
-	OnHoldReset.Broadcast();
+	BroadcastHoldProgress(0.f);
+	BroadcastHoldReset();
+}
+
+void UInteractionComponent::BroadcastFocusChanged(AActor* NewActor, AActor* PrevActor, int32 PrevItem)
+{
+	TRACE_INTERACTION_FOCUS_CHANGED(InteractorActor.Get(), NewActor, PrevActor);
+
+	if (!PendingFrameDelta.bFocusChanged)
+	{
+		PendingFrameDelta.PreviousFocusedActor = PrevActor;
+		PendingFrameDelta.PreviousFocusedItem = PrevItem;
+	}
+	PendingFrameDelta.bFocusChanged = true;
+
+	OnFocusChangedNative.Broadcast(NewActor, PrevActor);
+	if (OnFocusChanged.IsBound())
+	{
+		OnFocusChanged.Broadcast(NewActor, PrevActor);
+	}
+}
+
+void UInteractionComponent::BroadcastQueryUpdated()
+{
+	PendingFrameDelta.bQueryChanged = true;
+	++QueryRevision;
+
+	OnQueryUpdatedNative.Broadcast(CachedQueryResult);
+	if (OnQueryUpdated.IsBound())
+	{
+		OnQueryUpdated.Broadcast(CachedQueryResult);
+	}
+}
+
+void UInteractionComponent::BroadcastHoldProgress(float Progress)
+{
+	PendingFrameDelta.bHoldChanged = true;
+
+	OnHoldProgressNative.Broadcast(Progress);
+	if (OnHoldProgress.IsBound())
+	{
+		OnHoldProgress.Broadcast(Progress);
+	}
+}
+
+void UInteractionComponent::BroadcastHoldReset()
+{
+	PendingFrameDelta.bHoldChanged = true;
+	PendingFrameDelta.bHoldReset = true;
+
+	OnHoldResetNative.Broadcast();
+	if (OnHoldReset.IsBound())
+	{
+		OnHoldReset.Broadcast();
+	}
+}
+
+void UInteractionComponent::BroadcastHoldCompleted()
+{
+	PendingFrameDelta.bHoldChanged = true;
+	PendingFrameDelta.bHoldCompleted = true;
+
+	OnHoldCompletedNative.Broadcast();
+	if (OnHoldCompleted.IsBound())
+	{
+		OnHoldCompleted.Broadcast();
+	}
+}
+
+void UInteractionComponent::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	// Post actor tick runs after timers, so scans and hold ticks of this frame are already collected.
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	FlushFrameDelta();
+}
+
+void UInteractionComponent::FlushFrameDelta()
+{
+	if (!PendingFrameDelta.HasChanges())
+	{
+		return;
+	}
+
+	FInteractionFrameDelta Delta = MoveTemp(PendingFrameDelta);
+	PendingFrameDelta = FInteractionFrameDelta{};
+
+	// Fill the final state of the frame
+	Delta.FocusedActor = FocusedActor.Get();
+	Delta.FocusedItem = FocusedItem;
+	Delta.bFocusChanged = Delta.bFocusChanged
+		&& (Delta.FocusedActor != Delta.PreviousFocusedActor || Delta.FocusedItem != Delta.PreviousFocusedItem);
+	Delta.bHolding = bIsHolding;
+	Delta.HoldProgress = GetHoldProgress();
+
+	if (Delta.bQueryChanged)
+	{
+		Delta.QueryResult = CachedQueryResult;
+	}
+
+	OnFrameDeltaNative.Broadcast(Delta);
+	if (OnFrameDelta.IsBound())
+	{
+		OnFrameDelta.Broadcast(Delta);
+	}
 }
 
 void UInteractionComponent::EnableInteraction()
@@ -451,14 +950,51 @@ void UInteractionComponent::ToggleDebugOverlay()
 	if (DebugHelper)
 	{
 		DebugHelper->SetEnabled(bDebugOverlayEnabled);
+		bHasDebugSnapshot = false;
 		DebugPushSnapshot();
 	}
 }
 
+void UInteractionComponent::ToggleWorldInspector()
+{
+	bWorldInspectorEnabled = !bWorldInspectorEnabled;
+	if (WorldInspector)
+	{
+		WorldInspector->SetEnabled(bWorldInspectorEnabled);
+	}
+}
+
 void UInteractionComponent::DebugPushSnapshot() const
 {
 	if (!DebugHelper || !DebugHelper->IsEnabled()) return;
 
+	SCOPE_CYCLE_COUNTER(STAT_InteractionDebugSnapshot);
+
+	// Hash the inputs first so an unchanged state costs no snapshot copy.
+	const float HoldProgress = GetHoldProgress();
+	const uint32 Flags = (bLastTraceHit ? 1u : 0u) | (bLastHitWasInteractable ? 2u : 0u)
+		| (bEnabled ? 4u : 0u) | (bIsHolding ? 8u : 0u);
+
+	uint32 Hash = GetTypeHash(FocusedActor);
+	Hash = HashCombine(Hash, GetTypeHash(FocusedItem));
+	Hash = HashCombine(Hash, GetTypeHash(LastHitActor));
+	Hash = HashCombine(Hash, GetTypeHash(LastTraceStart));
+	Hash = HashCombine(Hash, GetTypeHash(LastTraceEnd));
+	Hash = HashCombine(Hash, GetTypeHash(LastHitImpactPoint));
+	Hash = HashCombine(Hash, GetTypeHash(QueryRevision));
+	Hash = HashCombine(Hash, GetTypeHash(HoldProgress));
+	Hash = HashCombine(Hash, GetTypeHash(Flags));
+	Hash = HashCombine(Hash, GetTypeHash(ScanInterval));
+	Hash = HashCombine(Hash, GetTypeHash(TraceDistance));
+	Hash = HashCombine(Hash, GetTypeHash(TraceRadius));
+
+	if (bHasDebugSnapshot && Hash == LastDebugSnapshotHash)
+	{
+		return;
+	}
+	LastDebugSnapshotHash = Hash;
+	bHasDebugSnapshot = true;
+
 	FInteractionDebugSnapshot S;
 	S.Owner = GetOwner();
 	S.FocusedActor = FocusedActor;
@@ -466,13 +1002,15 @@ void UInteractionComponent::DebugPushSnapshot() const
 	S.TraceEnd = LastTraceEnd;
 	S.bTraceHit = bLastTraceHit;
 	S.HitActor = LastHitActor;
-	S.HitResult = LastHitResult;
+	S.HitImpactPoint = LastHitImpactPoint;
+	S.HitImpactNormal = LastHitImpactNormal;
 
 	S.QueryResult = CachedQueryResult;
+	S.QueryRevision = QueryRevision;
 
 	S.bEnabled = bEnabled;
 	S.bHolding = bIsHolding;
-	S.HoldProgress01 = GetHoldProgress();
+	S.HoldProgress01 = HoldProgress;
 
 	S.ScanInterval = ScanInterval;
 	S.TraceDistance = TraceDistance;
@@ -480,4 +1018,75 @@ void UInteractionComponent::DebugPushSnapshot() const
 	S.bHitWasInteractable = bLastHitWasInteractable;
 
 	DebugHelper->Update(S);
-}
\ No newline at end of file
+}
+
+void UInteractionComponent::RecordFlightSnapshot()
+{
+	if (FlightRecorder.GetCapacity() == 0)
+	{
+		// Player pawns are usually possessed after BeginPlay, so recording starts with the first scan that qualifies.
+		if (FlightRecorderCapacity <= 0 || (!bFlightRecordAllInteractors && !IsLocalPlayerInteractor())) return;
+		InitializeFlightRecorder();
+	}
+
+	FInteractionFlightRecord R;
+	R.Time = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	R.TraceStart = FVector3f(LastTraceStart);
+	R.TraceEnd = FVector3f(LastTraceEnd);
+	R.ImpactPoint = FVector3f(LastHitImpactPoint);
+	R.HitActorId = LastHitActor.IsValid() ? LastHitActor->GetUniqueID() : 0;
+	R.FocusedActorId = FocusedActor.IsValid() ? FocusedActor->GetUniqueID() : 0;
+	R.HoldProgress = GetHoldProgress();
+	R.UnmetRequirements = static_cast<int16>(CachedQueryResult.UnmetRequirementNumber);
+	R.InputType = static_cast<uint8>(CachedQueryResult.InputType);
+
+	if (bLastTraceHit)                        R.Flags |= FInteractionFlightRecord::TraceHit;
+	if (bLastHitWasInteractable)              R.Flags |= FInteractionFlightRecord::HitInteractable;
+	if (CachedQueryResult.bShouldShowPrompt)  R.Flags |= FInteractionFlightRecord::PromptVisible;
+	if (CachedQueryResult.IsAvailable())      R.Flags |= FInteractionFlightRecord::Available;
+	if (bIsHolding)                           R.Flags |= FInteractionFlightRecord::Holding;
+	if (bEnabled)                             R.Flags |= FInteractionFlightRecord::Enabled;
+
+	FlightRecorder.Record(R);
+}
+
+void UInteractionComponent::InitializeFlightRecorder()
+{
+	FlightRecorder.Initialize(FlightRecorderCapacity);
+	EnsureHandle = FCoreDelegates::OnHandleSystemEnsure.AddUObject(this, &UInteractionComponent::HandleSystemEnsure);
+	SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddUObject(this, &UInteractionComponent::HandleSystemError);
+}
+
+bool UInteractionComponent::DumpFlightRecorder(const FString& Reason, bool bAsync) const
+{
+	if (FlightRecorder.Num() == 0) return false;
+
+	const FString FileName = FString::Printf(TEXT("FlightRecorder_%s_%s_%s.ifr"),
+		*GetNameSafe(GetOwner()), *Reason, *FDateTime::Now().ToString());
+	const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Interaction"), FileName);
+
+	if (bAsync)
+	{
+		FlightRecorder.DumpToFileAsync(FilePath);
+		return true;
+	}
+	return FlightRecorder.DumpToFile(FilePath);
+}
+
+void UInteractionComponent::HandleSystemEnsure()
+{
+	// Ensures are recoverable and the game keeps running, so the file write must not stall the frame.
+	if (CVarFlightRecorderDumpOnFailure.GetValueOnAnyThread())
+	{
+		DumpFlightRecorder(TEXT("Ensure"), /*bAsync*/ true);
+	}
+}
+
+void UInteractionComponent::HandleSystemError()
+{
+	// The process is going down; a background write would not finish.
+	if (CVarFlightRecorderDumpOnFailure.GetValueOnAnyThread())
+	{
+		DumpFlightRecorder(TEXT("Failure"));
+	}
+}
@@ -3,15 +3,83 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Interaction/Data/InteractionTypes.h"
+#include "Interaction/Debug/InteractionFlightRecorder.h"
+#include "Interaction/InteractionReplication.h"
 #include "InteractionComponent.generated.h"
 
+/**
+ * Consolidated view of everything that changed on an interaction component during one frame.
+ * Flags tell what changed, the remaining fields hold the final state at the end of the frame.
+ * Intermediate steps (focus end/start pairs, repeated query refreshes, hold ticks) are folded away.
+ */
+USTRUCT(BlueprintType)
+struct FInteractionFrameDelta
+{
+	GENERATED_BODY()
+
+	/** Focused actor at the end of the frame differs from the one at the start. */
+	UPROPERTY(BlueprintReadOnly, Category="Interaction")
+	bool bFocusChanged = false;
+
+	/** At least one query broadcast happened this frame. */
+	UPROPERTY(BlueprintReadOnly, Category="Interaction")
+	bool bQueryChanged = false;
+
+	/** At least one hold progress/reset/completed broadcast happened this frame. */
+	UPROPERTY(BlueprintReadOnly, Category="Interaction")
+	bool bHoldChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category="Interaction")
+	TObjectPtr<AActor> FocusedActor = nullptr;
+
+	/** Focused actor at the start of the frame (only meaningful when bFocusChanged). */
+	UPROPERTY(BlueprintReadOnly, Category="Interaction")
+	TObjectPtr<AActor> PreviousFocusedActor = nullptr;
+
+	/** Focused item (e.g. mesh instance) within FocusedActor, INDEX_NONE when the whole actor is the target. */
+	UPROPERTY(BlueprintReadOnly, Category="Interaction")
+	int32 FocusedItem = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category="Interaction")
+	int32 PreviousFocusedItem = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category="Interaction")
+	FInteractionQueryResult QueryResult;
+
+	UPROPERTY(BlueprintReadOnly, Category="Interaction|Hold")
+	bool bHolding = false;
+
+	UPROPERTY(BlueprintReadOnly, Category="Interaction|Hold")
+	float HoldProgress = 0.f;
+
+	/** A hold was completed during the frame. */
+	UPROPERTY(BlueprintReadOnly, Category="Interaction|Hold")
+	bool bHoldCompleted = false;
+
+	/** A hold was reset (released, cancelled or completed) during the frame. */
+	UPROPERTY(BlueprintReadOnly, Category="Interaction|Hold")
+	bool bHoldReset = false;
+
+	bool HasChanges() const { return bFocusChanged || bQueryChanged || bHoldChanged; }
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnFocusChanged, AActor*, NewFocusedActor, AActor*, PreviousFocusedActor);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnQueryUpdated, const FInteractionQueryResult&, QueryResult);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHoldProgress, float, NormalizedProgress);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnHoldReset);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnHoldCompleted);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionFrameDelta, const FInteractionFrameDelta&, Delta);
+
+// Native counterparts, broadcast first and without going through reflection.
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnFocusChangedNative, AActor* /*NewFocusedActor*/, AActor* /*PreviousFocusedActor*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnQueryUpdatedNative, const FInteractionQueryResult& /*QueryResult*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHoldProgressNative, float /*NormalizedProgress*/);
+DECLARE_MULTICAST_DELEGATE(FOnHoldResetNative);
+DECLARE_MULTICAST_DELEGATE(FOnHoldCompletedNative);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractionFrameDeltaNative, const FInteractionFrameDelta& /*Delta*/);
 
 class IInteractable;
+class UKeyringComponent;
 /**
  * UInteractionComponent
  *
@@ -19,13 +87,23 @@ class IInteractable;
  * The component depends only on the IInteractable interface.
  *
  * UI should listen to OnQueryUpdated and OnHoldProgress.
- * QueryInteraction is called whenever focus changes and whenever the player interacts with the object
+ * C++ listeners should bind the *Native events; the dynamic events are only broadcast when Blueprint listeners are bound.
+ * Listeners doing expensive work per event (UI relayout, audio) should use OnFrameDelta, which fires at most once per frame.
+ * QueryInteraction is called whenever focus changes and whenever the player interacts with the object,
+ * and again on the next scan when the focused state or the interactor's keys changed (e.g. through replication).
+ *
+ * In networked games only locally controlled interactors scan. Clients predict presses and holds: the interaction
+ * runs locally right away and a Server_Interact request carries a prediction key. The server validates and runs it,
+ * then confirms on the next frame (after its results were replicated), and the client reverts its predicted state
+ * and keys to the replicated ones.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class INTERACTIONFRAMEWORK_API UInteractionComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend struct FInteractionBenchmarkAccess;
+
 public:
 	UInteractionComponent();
 
@@ -48,6 +126,18 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Interaction|Events")
 	FOnHoldCompleted OnHoldCompleted;
 
+	/** Coalesced events, broadcast once at the end of any frame that had changes. */
+	UPROPERTY(BlueprintAssignable, Category="Interaction|Events")
+	FOnInteractionFrameDelta OnFrameDelta;
+
+	// Native events
+	FOnFocusChangedNative OnFocusChangedNative;
+	FOnQueryUpdatedNative OnQueryUpdatedNative;
+	FOnHoldProgressNative OnHoldProgressNative;
+	FOnHoldResetNative OnHoldResetNative;
+	FOnHoldCompletedNative OnHoldCompletedNative;
+	FOnInteractionFrameDeltaNative OnFrameDeltaNative;
+
 	// Input entry points
 	UFUNCTION(BlueprintCallable, Category="Interaction")
 	void BeginInteract();
@@ -59,15 +149,38 @@ public:
 	UFUNCTION(BlueprintPure, Category="Interaction")
 	AActor* GetFocusedActor() const { return FocusedActor.Get(); }
 
+	/** Object implementing IInteractable for the current focus: the focused actor or one of its components. */
+	UFUNCTION(BlueprintPure, Category="Interaction")
+	UObject* GetFocusedInteractable() const { return FocusedObject.Get(); }
+
+	/** Item within the focused interactable (instance index or slot), INDEX_NONE for whole-object interactables. */
+	UFUNCTION(BlueprintPure, Category="Interaction")
+	int32 GetFocusedItem() const { return FocusedItem; }
+
 	UFUNCTION(BlueprintPure, Category="Interaction")
 	const FInteractionQueryResult& GetCachedQueryResult() const { return CachedQueryResult; }
 
 	UFUNCTION(BlueprintPure, Category="Interaction")
 	bool IsHolding() const { return bIsHolding; }
 
+	/** Interactions executed so far, presses and completed holds. A change between two reads means one ran. */
+	uint32 GetNumInteractsExecuted() const { return NumInteractsExecuted; }
+
+	/** Focus scans run so far. */
+	uint32 GetNumFocusScans() const { return NumFocusScans; }
+
 	UFUNCTION(BlueprintPure, Category="Interaction")
 	float GetHoldProgress() const;
 
+	/** Where the interactor looks from: controller view point for pawns, actor eyes otherwise. */
+	bool GetViewPoint(FVector& OutViewLoc, FRotator& OutViewRot) const;
+
+	/** True for a pawn controlled by a local player. AI and remote interactors return false. */
+	bool IsLocalPlayerInteractor() const;
+
+	/** Timers this component currently has registered (focus scan, hold tick). For leak tracking. */
+	int32 GetNumActiveTimers() const;
+
 	// Debug
 	UFUNCTION(BlueprintCallable, Category="Interaction|Debug")
 	void EnableInteraction();
@@ -84,7 +197,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Interaction|Debug")
 	void ToggleDebugOverlay();
 
+	/** Labels every registered interactable in view with its state, availability and prompt. */
+	UFUNCTION(BlueprintCallable, Category="Interaction|Debug")
+	void ToggleWorldInspector();
+
 	void DebugPushSnapshot() const;
+
+	const FInteractionFlightRecorder& GetFlightRecorder() const { return FlightRecorder; }
+
+	/**
+	 * Writes the flight recorder to Saved/Interaction. Reason ends up in the file name.
+	 * With bAsync only the dump is built here and the file is written from a background task.
+	 */
+	bool DumpFlightRecorder(const FString& Reason, bool bAsync = false) const;
 	
 public:
 	// Scan configurations
@@ -115,17 +240,29 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category="Interaction|Debug")
 	bool bDebugOverlayEnabled = false;
 
+	UPROPERTY(Transient)
+	class UInteractionWorldInspector* WorldInspector = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Debug")
+	bool bWorldInspectorEnabled = false;
+
 	UPROPERTY(EditDefaultsOnly, Category="Interaction|Debug")
 	bool bDebugDrawTrace = true;
 
+	/** Number of scans kept by the flight recorder (1200 = 60s at the default scan interval). 0 disables it. */
+	UPROPERTY(EditDefaultsOnly, Category="Interaction|Debug", meta=(ClampMin="0"))
+	int32 FlightRecorderCapacity = 1200;
+
+	/** By default only local player interactors record. Enable for AI interactors, e.g. in stress and soak runs. */
 	UPROPERTY(EditDefaultsOnly, Category="Interaction|Debug")
-	float DebugDrawDuration = 0.06f;
+	bool bFlightRecordAllInteractors = false;
 
 	FVector LastTraceStart = FVector::ZeroVector;
 	FVector LastTraceEnd = FVector::ZeroVector;
 	bool bLastTraceHit = false;
 	TWeakObjectPtr<AActor> LastHitActor;
-	FHitResult LastHitResult;
+	FVector LastHitImpactPoint = FVector::ZeroVector;
+	FVector LastHitImpactNormal = FVector::ZeroVector;
 	bool bLastHitWasInteractable = false;
 	
 private:
@@ -134,15 +271,36 @@ private:
 	void StopFocusScan();
 	void PerformFocusScan();
 
-	bool FindInteractableInView(AActor*& OutActor, TScriptInterface<IInteractable>& OutInteractable);
-	bool GetViewPoint(FVector& OutViewLoc, FRotator& OutViewRot) const;
+	bool FindInteractableInView(AActor*& OutActor, TScriptInterface<IInteractable>& OutInteractable, int32& OutItem);
+	static bool ResolveInteractable(const FHitResult& Hit, TScriptInterface<IInteractable>& OutInteractable, int32& OutItem);
 
-	void SetFocused(AActor* NewActor, const TScriptInterface<IInteractable> NewInteractable);
+	void SetFocused(AActor* NewActor, const TScriptInterface<IInteractable> NewInteractable, int32 NewItem);
 	void ClearFocus();
 	void RefreshQuery();
 
+	/** Focused state or the interactor's keys changed since the cached query was built. */
+	bool IsCachedQueryStale() const;
+
+	/** Query/interact with the focused object, going through the item hooks when it has items. */
+	FInteractionQueryResult QueryFocused(AActor* Interactor) const;
+	void InteractFocused(AActor* Interactor);
+
 	// Press
 	void ExecutePress();
+	static void InteractTarget(UObject* Target, int32 Item, AActor* Interactor);
+
+	// Networking
+	bool IsPredictingClient() const { return GetOwnerRole() == ROLE_AutonomousProxy; }
+	bool IsLocallyControlledInteractor() const;
+	void PredictInteract(AActor* Interactor);
+	bool ValidateRequest(const FInteractionRequest& Request) const;
+	void FlushConfirmations();
+
+	UFUNCTION(Server, Reliable)
+	void Server_Interact(const FInteractionRequest& Request);
+
+	UFUNCTION(Client, Reliable)
+	void Client_ConfirmInteract(uint16 PredictionKey, bool bAccepted);
 
 	// Hold
 	void BeginHold(float DurationSeconds);
@@ -150,13 +308,62 @@ private:
 	void CompleteHold();
 	void ResetHold();
 
+	// Event dispatch (native first, dynamic only when bound)
+	void BroadcastFocusChanged(AActor* NewActor, AActor* PrevActor, int32 PrevItem);
+	void BroadcastQueryUpdated();
+	void BroadcastHoldProgress(float Progress);
+	void BroadcastHoldReset();
+	void BroadcastHoldCompleted();
+
+	// Flight recorder
+	void RecordFlightSnapshot();
+	void InitializeFlightRecorder();
+	void HandleSystemEnsure();
+	void HandleSystemError();
+
+	// Frame coalescing
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void FlushFrameDelta();
+
 private:
 	TWeakObjectPtr<AActor> InteractorActor;
 	TWeakObjectPtr<AActor> FocusedActor;
 	TScriptInterface<IInteractable> FocusedInteractable;
+
+	/** Weak handle of FocusedInteractable's object, which may be a component that dies before its actor. */
+	TWeakObjectPtr<UObject> FocusedObject;
+	int32 FocusedItem = INDEX_NONE;
 	
 	FInteractionQueryResult CachedQueryResult;
 
+	/** OnFocusStart was delivered to the focused actor, so it is owed an OnFocusEnd. Skipped for non-Near tiers. */
+	bool bFocusHooksActive = false;
+
+	/** Incremented on every query broadcast, lets debug consumers detect query changes cheaply. */
+	uint32 QueryRevision = 0;
+
+	/** What the cached query was built from, see IsCachedQueryStale. */
+	TWeakObjectPtr<UKeyringComponent> InteractorKeyring;
+	FName CachedQueryStateId = NAME_None;
+	FName CachedQueryItemStateId = NAME_None;
+	uint32 CachedQueryKeyringRevision = 0;
+
+	/** Client: interacts sent to the server and not confirmed yet. */
+	struct FPendingPrediction
+	{
+		uint16 PredictionKey = 0;
+		TWeakObjectPtr<UObject> Target;
+	};
+	TArray<FPendingPrediction> PendingPredictions;
+	uint16 LastPredictionKey = 0;
+
+	/** Server: confirmations owed to the owning client (prediction key, accepted), sent on the next frame. */
+	TArray<TPair<uint16, bool>> PendingConfirmations;
+
+	/** Hash of the last state pushed to the debug helper; unchanged states are not pushed. */
+	mutable uint32 LastDebugSnapshotHash = 0;
+	mutable bool bHasDebugSnapshot = false;
+
 	FTimerHandle FocusScanTimer;
 
 	// Hold state
@@ -164,6 +371,19 @@ private:
 	float HoldElapsed = 0.f;
 	float HoldDuration = 0.f;
 	FTimerHandle HoldTickTimer;
+
+	uint32 NumInteractsExecuted = 0;
+	uint32 NumFocusScans = 0;
+
+	// Events collected since the last flush; final state is read from the component when flushing.
+	// A UPROPERTY so the actors it holds across the frame are seen by GC.
+	UPROPERTY(Transient)
+	FInteractionFrameDelta PendingFrameDelta;
+	FDelegateHandle PostActorTickHandle;
+
+	FInteractionFlightRecorder FlightRecorder;
+	FDelegateHandle EnsureHandle;
+	FDelegateHandle SystemErrorHandle;
 	
 	bool bEnabled = true;
 };
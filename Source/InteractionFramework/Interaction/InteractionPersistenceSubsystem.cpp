@@ -0,0 +1,224 @@
+#include "InteractionPersistenceSubsystem.h"
+#include "Interactable.h"
+#include "InteractionStats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarPersistenceReserve(
+	TEXT("Interaction.Persistence.Reserve"),
+	4096,
+	TEXT("Rows reserved in the interaction persistence table at world start. Set to the expected interactable count of the world."));
+
+UInteractionPersistenceSubsystem* UInteractionPersistenceSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionPersistenceSubsystem>() : nullptr;
+}
+
+bool UInteractionPersistenceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UInteractionPersistenceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const int32 Reserve = FMath::Max(CVarPersistenceReserve.GetValueOnGameThread(), 0);
+	RowById.Reserve(Reserve);
+	Rows.Reserve(Reserve);
+	INC_MEMORY_STAT_BY(STAT_InteractionPersistenceMemory, RowById.GetAllocatedSize() + Rows.GetAllocatedSize());
+}
+
+void UInteractionPersistenceSubsystem::Deinitialize()
+{
+	DEC_MEMORY_STAT_BY(STAT_InteractionPersistenceMemory, RowById.GetAllocatedSize() + Rows.GetAllocatedSize());
+	RowById.Empty();
+	Rows.Empty();
+	DirtyRows.Empty();
+	DataAssets.Empty();
+	AssetIndexByObject.Empty();
+	Super::Deinitialize();
+}
+
+void UInteractionPersistenceSubsystem::Reset()
+{
+	// Keeps the reserved capacity, so the memory stat is unchanged and a reload does not regrow the table.
+	RowById.Reset();
+	Rows.Reset();
+	DirtyRows.Reset();
+	DataAssets.Reset();
+	AssetIndexByObject.Reset();
+}
+
+int32 UInteractionPersistenceSubsystem::FindOrAddRow(const FGuid& PersistentId)
+{
+	if (const int32* Index = RowById.Find(PersistentId))
+	{
+		return *Index;
+	}
+
+	const SIZE_T OldSize = RowById.GetAllocatedSize() + Rows.GetAllocatedSize();
+	const int32 Index = Rows.AddDefaulted();
+	DirtyRows.Add(true);
+	RowById.Add(PersistentId, Index);
+
+	const SIZE_T NewSize = RowById.GetAllocatedSize() + Rows.GetAllocatedSize();
+	if (NewSize != OldSize)
+	{
+		DEC_MEMORY_STAT_BY(STAT_InteractionPersistenceMemory, OldSize);
+		INC_MEMORY_STAT_BY(STAT_InteractionPersistenceMemory, NewSize);
+	}
+	return Index;
+}
+
+void UInteractionPersistenceSubsystem::WriteRow(int32 RowIndex, const FRow& Row)
+{
+	if (Rows[RowIndex] == Row) return;
+
+	Rows[RowIndex] = Row;
+	DirtyRows[RowIndex] = true;
+}
+
+void UInteractionPersistenceSubsystem::ClearDirty()
+{
+	DirtyRows.SetRange(0, DirtyRows.Num(), false);
+}
+
+uint16 UInteractionPersistenceSubsystem::FindOrAddDataAsset(const UObject* DataAsset)
+{
+	if (!DataAsset) return NoAsset;
+
+	if (const uint16* Index = AssetIndexByObject.Find(DataAsset))
+	{
+		return *Index;
+	}
+
+	if (DataAssets.Num() >= NoAsset) return NoAsset;
+
+	const uint16 Index = static_cast<uint16>(DataAssets.Add(DataAsset));
+	AssetIndexByObject.Add(DataAsset, Index);
+	return Index;
+}
+
+const UInteractionPersistenceSubsystem::FRow* UInteractionPersistenceSubsystem::FindRow(const FGuid& PersistentId) const
+{
+	const int32* Index = RowById.Find(PersistentId);
+	return Index ? &Rows[*Index] : nullptr;
+}
+
+void UInteractionPersistenceSubsystem::Record(const IInteractable& Interactable)
+{
+	const FGuid PersistentId = Interactable.GetPersistentId();
+	if (!PersistentId.IsValid()) return;
+
+	// Objects without a state of their own (e.g. instanced components) still record their items.
+	int32 StateIndex = INDEX_NONE;
+	EInteractionPersistFlags Flags = EInteractionPersistFlags::None;
+	if (Interactable.GetPersistentState(StateIndex, Flags))
+	{
+		const int32 RowIndex = FindOrAddRow(PersistentId);
+
+		FRow Row = Rows[RowIndex];
+		Row.StateIndex = static_cast<int16>(FMath::Clamp(StateIndex, static_cast<int32>(INDEX_NONE), static_cast<int32>(MAX_int16)));
+		Row.AssetIndex = FindOrAddDataAsset(Interactable.GetPersistentDataAsset());
+		Row.Flags |= Flags;
+		WriteRow(RowIndex, Row);
+	}
+
+	const int32 NumItems = Interactable.GetNumPersistentItems();
+	for (int32 Item = 0; Item < NumItems; ++Item)
+	{
+		int32 ItemStateIndex = INDEX_NONE;
+		if (!Interactable.GetPersistentItemState(Item, ItemStateIndex)) continue;
+
+		FRow ItemRow;
+		ItemRow.StateIndex = static_cast<int16>(FMath::Clamp(ItemStateIndex, static_cast<int32>(INDEX_NONE), static_cast<int32>(MAX_int16)));
+		ItemRow.AssetIndex = FindOrAddDataAsset(Interactable.GetPersistentItemDataAsset(Item));
+		WriteRow(FindOrAddRow(MakeItemId(PersistentId, Item)), ItemRow);
+	}
+}
+
+void UInteractionPersistenceSubsystem::AddFlags(const FGuid& PersistentId, EInteractionPersistFlags Flags)
+{
+	if (!PersistentId.IsValid()) return;
+
+	const int32 RowIndex = FindOrAddRow(PersistentId);
+	FRow Row = Rows[RowIndex];
+	Row.Flags |= Flags;
+	WriteRow(RowIndex, Row);
+}
+
+void UInteractionPersistenceSubsystem::RemoveFlags(const FGuid& PersistentId, EInteractionPersistFlags Flags)
+{
+	if (!PersistentId.IsValid()) return;
+
+	if (const int32* Index = RowById.Find(PersistentId))
+	{
+		FRow Row = Rows[*Index];
+		Row.Flags &= ~Flags;
+		WriteRow(*Index, Row);
+	}
+}
+
+void UInteractionPersistenceSubsystem::SetRow(const FGuid& PersistentId, const FRow& Row)
+{
+	if (!PersistentId.IsValid()) return;
+
+	WriteRow(FindOrAddRow(PersistentId), Row);
+}
+
+bool UInteractionPersistenceSubsystem::Restore(IInteractable& Interactable) const
+{
+	const FGuid PersistentId = Interactable.GetPersistentId();
+	if (!PersistentId.IsValid()) return false;
+
+	const int32 NumItems = Interactable.GetNumPersistentItems();
+	for (int32 Item = 0; Item < NumItems; ++Item)
+	{
+		const FRow* ItemRow = FindRow(MakeItemId(PersistentId, Item));
+		const int16 ItemStateIndex = ItemRow ? GetStateIndexFor(*ItemRow, Interactable.GetPersistentItemDataAsset(Item)) : INDEX_NONE;
+		if (ItemStateIndex != INDEX_NONE)
+		{
+			Interactable.RestorePersistentItemState(Item, ItemStateIndex);
+		}
+	}
+
+	// Flag-only rows (e.g. a consumed pickup) have no asset and still apply.
+	const FRow* Row = FindRow(PersistentId);
+	return Row && Interactable.RestorePersistentState(GetStateIndexFor(*Row, Interactable.GetPersistentDataAsset()), Row->Flags);
+}
+
+int16 UInteractionPersistenceSubsystem::GetStateIndexFor(const FRow& Row, const UObject* DataAsset) const
+{
+	if (Row.AssetIndex == NoAsset) return Row.StateIndex;
+
+	// Assets that were unloaded since are not the one the interactable holds now.
+	const bool bSameAsset = DataAssets.IsValidIndex(Row.AssetIndex) && DataAssets[Row.AssetIndex].Get() == DataAsset;
+	return bSameAsset ? Row.StateIndex : static_cast<int16>(INDEX_NONE);
+}
+
+FGuid UInteractionPersistenceSubsystem::MakeItemId(const FGuid& PersistentId, int32 Item)
+{
+	return FGuid(PersistentId.A, PersistentId.B, PersistentId.C ^ 0x49544D00, HashCombine(PersistentId.D, static_cast<uint32>(Item)));
+}
+
+#if WITH_EDITOR
+
+void UInteractionPersistenceSubsystem::AssignPersistentId(FGuid& PersistentId, UObject* Owner, bool bForceNew)
+{
+	if (!Owner || Owner->IsTemplate()) return;
+
+	// Only placed interactables are persistent; anything spawned at runtime keeps an invalid id.
+	const UWorld* World = Owner->GetWorld();
+	if (!World || World->IsGameWorld()) return;
+
+	if (bForceNew || !PersistentId.IsValid())
+	{
+		// Dirties the package so the id is saved with the level instead of being regenerated on every load.
+		Owner->Modify();
+		PersistentId = FGuid::NewGuid();
+	}
+}
+
+#endif
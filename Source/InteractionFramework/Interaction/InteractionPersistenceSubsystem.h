@@ -0,0 +1,107 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Interaction/Data/InteractionTypes.h"
+#include "InteractionPersistenceSubsystem.generated.h"
+
+class IInteractable;
+
+/**
+ * UInteractionPersistenceSubsystem
+ *
+ * Keeps interactable state alive while the interactable's level or World Partition cell is streamed out.
+ * Interactables record their state index and flags when they leave play, keyed by their persistent id;
+ * their slots or instances get one row each under an id derived from it.
+ * When they stream back in, the recorded state is applied in InitializeInteraction. That runs after BeginPlay,
+ * in the registry's time-sliced deferred pass, or earlier on demand when the state is first read or set
+ * (focus, SetInteractionState from a Blueprint BeginPlay), so nothing observes the authored state first.
+ * Rows recorded for a different data asset than the interactable now uses are ignored.
+ *
+ * The table is flat: an id -> row map plus a dense array of 6-byte rows (state index, data asset index, flags),
+ * pre-reserved by Interaction.Persistence.Reserve. Once an interactable has a row, streaming it out and back in
+ * allocates nothing. Rows changed since the last ClearDirty() are tracked for incremental saves.
+ */
+UCLASS()
+class INTERACTIONFRAMEWORK_API UInteractionPersistenceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr uint16 NoAsset = MAX_uint16;
+
+	struct FRow
+	{
+		int16 StateIndex = INDEX_NONE;
+		/** Index into GetDataAssets(), the asset StateIndex refers to. */
+		uint16 AssetIndex = NoAsset;
+		EInteractionPersistFlags Flags = EInteractionPersistFlags::None;
+
+		bool operator==(const FRow& Other) const
+		{
+			return StateIndex == Other.StateIndex && AssetIndex == Other.AssetIndex && Flags == Other.Flags;
+		}
+	};
+
+	static UInteractionPersistenceSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Stores the interactable's current state. No-op without a valid persistent id. */
+	void Record(const IInteractable& Interactable);
+
+	/** Sets flags on an interactable's row (e.g. Consumed) without touching its state. */
+	void AddFlags(const FGuid& PersistentId, EInteractionPersistFlags Flags);
+	void RemoveFlags(const FGuid& PersistentId, EInteractionPersistFlags Flags);
+
+	/**
+	 * Applies the recorded state and item states. Returns false when no usable state was recorded for the interactable
+	 * itself and it should use its defaults.
+	 */
+	bool Restore(IInteractable& Interactable) const;
+
+	const FRow* FindRow(const FGuid& PersistentId) const;
+
+	/** Row id of an item (slot, instance) of the interactable with the given persistent id. */
+	static FGuid MakeItemId(const FGuid& PersistentId, int32 Item);
+
+	int32 GetNumRows() const { return Rows.Num(); }
+
+	/** Raw table access for save games. */
+	const TMap<FGuid, int32>& GetRowIndices() const { return RowById; }
+	const TArray<FRow>& GetRows() const { return Rows; }
+	bool IsRowDirty(int32 RowIndex) const { return DirtyRows.IsValidIndex(RowIndex) && DirtyRows[RowIndex]; }
+	void ClearDirty();
+	void SetRow(const FGuid& PersistentId, const FRow& Row);
+
+	/** Drops every row but keeps the table's capacity. */
+	void Reset();
+
+	/** Data assets referenced by rows; entries of unloaded assets may be null. */
+	const TArray<TWeakObjectPtr<const UObject>>& GetDataAssets() const { return DataAssets; }
+	uint16 FindOrAddDataAsset(const UObject* DataAsset);
+
+#if WITH_EDITOR
+	/** Gives an editor-placed interactable a persistent id (new one when bForceNew, e.g. after copy/paste). */
+	static void AssignPersistentId(FGuid& PersistentId, UObject* Owner, bool bForceNew);
+#endif
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	TMap<FGuid, int32> RowById;
+	TArray<FRow> Rows;
+	TBitArray<> DirtyRows;
+
+	TArray<TWeakObjectPtr<const UObject>> DataAssets;
+	TMap<const UObject*, uint16> AssetIndexByObject;
+
+	int32 FindOrAddRow(const FGuid& PersistentId);
+	void WriteRow(int32 RowIndex, const FRow& Row);
+
+	/** State index of a row, or INDEX_NONE when it was recorded against another data asset. */
+	int16 GetStateIndexFor(const FRow& Row, const UObject* DataAsset) const;
+};
@@ -0,0 +1,159 @@
+#include "InteractionPickupPoolSubsystem.h"
+#include "InteractablePickupActor.h"
+#include "InteractionFramework.h"
+#include "InteractionStats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarPickupPoolMaxPerClass(
+	TEXT("Interaction.PickupPool.MaxPerClass"),
+	32,
+	TEXT("Max pooled pickups per class for classes that do not set PoolSize. 0 disables pooling."));
+
+static FAutoConsoleCommandWithWorld PickupPoolStatsCommand(
+	TEXT("Interaction.PickupPool.Stats"),
+	TEXT("Logs pickup pool hits, misses and pooled counts per class."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UInteractionPickupPoolSubsystem* Pool = UInteractionPickupPoolSubsystem::Get(World))
+		{
+			Pool->LogStats();
+		}
+	}));
+
+UInteractionPickupPoolSubsystem* UInteractionPickupPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionPickupPoolSubsystem>() : nullptr;
+}
+
+bool UInteractionPickupPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UInteractionPickupPoolSubsystem::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_InteractionPickupPooled, NumPooled);
+	NumPooled = 0;
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+int32 UInteractionPickupPoolSubsystem::GetCapacity(const UClass* PickupClass)
+{
+	const AInteractablePickupActor* CDO = PickupClass ? PickupClass->GetDefaultObject<AInteractablePickupActor>() : nullptr;
+	const int32 ClassSize = CDO ? CDO->PoolSize : INDEX_NONE;
+	return ClassSize >= 0 ? ClassSize : FMath::Max(CVarPickupPoolMaxPerClass.GetValueOnGameThread(), 0);
+}
+
+AInteractablePickupActor* UInteractionPickupPoolSubsystem::SpawnPickup(UClass* PickupClass, const FTransform& Transform) const
+{
+	UWorld* World = GetWorld();
+	if (!World || !PickupClass) return nullptr;
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return World->SpawnActor<AInteractablePickupActor>(PickupClass, Transform, Params);
+}
+
+AInteractablePickupActor* UInteractionPickupPoolSubsystem::AcquirePickup(TSubclassOf<AInteractablePickupActor> PickupClass, const FTransform& Transform)
+{
+	if (!PickupClass) return nullptr;
+
+	if (FInteractionPickupPool* Pool = Pools.Find(PickupClass.Get()))
+	{
+		while (Pool->Free.Num() > 0)
+		{
+			AInteractablePickupActor* Pickup = Pool->Free.Pop(EAllowShrinking::No);
+			--NumPooled;
+			DEC_DWORD_STAT(STAT_InteractionPickupPooled);
+
+			if (!IsValid(Pickup)) continue;
+
+			++NumHits;
+			INC_DWORD_STAT(STAT_InteractionPickupPoolHits);
+			Pickup->ActivateFromPool(Transform, /*bAsNewSpawn*/ true);
+			return Pickup;
+		}
+	}
+
+	++NumMisses;
+	INC_DWORD_STAT(STAT_InteractionPickupPoolMisses);
+	return SpawnPickup(PickupClass.Get(), Transform);
+}
+
+bool UInteractionPickupPoolSubsystem::ReleasePickup(AInteractablePickupActor* Pickup)
+{
+	if (!IsValid(Pickup) || Pickup->IsPooled()) return false;
+
+	UClass* PickupClass = Pickup->GetClass();
+	FInteractionPickupPool& Pool = Pools.FindOrAdd(PickupClass);
+	if (Pool.Free.Num() >= GetCapacity(PickupClass)) return false;
+
+	Pickup->DeactivateToPool();
+	Pool.Free.Add(Pickup);
+	++NumPooled;
+	INC_DWORD_STAT(STAT_InteractionPickupPooled);
+	return true;
+}
+
+bool UInteractionPickupPoolSubsystem::ReactivatePickup(AInteractablePickupActor* Pickup)
+{
+	if (!IsValid(Pickup) || !Pickup->IsPooled()) return false;
+
+	FInteractionPickupPool* Pool = Pools.Find(Pickup->GetClass());
+	if (!Pool || Pool->Free.RemoveSingleSwap(Pickup, EAllowShrinking::No) == 0) return false;
+
+	--NumPooled;
+	DEC_DWORD_STAT(STAT_InteractionPickupPooled);
+	Pickup->ActivateFromPool(Pickup->GetActorTransform());
+	return true;
+}
+
+void UInteractionPickupPoolSubsystem::GetPooledPickups(TArray<AInteractablePickupActor*>& OutPickups) const
+{
+	for (const TPair<TObjectPtr<UClass>, FInteractionPickupPool>& Pair : Pools)
+	{
+		for (AInteractablePickupActor* Pickup : Pair.Value.Free)
+		{
+			if (IsValid(Pickup))
+			{
+				OutPickups.Add(Pickup);
+			}
+		}
+	}
+}
+
+void UInteractionPickupPoolSubsystem::Prewarm(TSubclassOf<AInteractablePickupActor> PickupClass, int32 Count)
+{
+	if (!PickupClass) return;
+
+	const int32 Target = FMath::Min(Count, GetCapacity(PickupClass.Get()));
+	const FInteractionPickupPool* Pool = Pools.Find(PickupClass.Get());
+	for (int32 i = Pool ? Pool->Free.Num() : 0; i < Target; ++i)
+	{
+		AInteractablePickupActor* Pickup = SpawnPickup(PickupClass.Get(), FTransform::Identity);
+		if (!Pickup || !ReleasePickup(Pickup)) break;
+	}
+}
+
+int32 UInteractionPickupPoolSubsystem::GetNumPooled(TSubclassOf<AInteractablePickupActor> PickupClass) const
+{
+	const FInteractionPickupPool* Pool = Pools.Find(PickupClass.Get());
+	return Pool ? Pool->Free.Num() : 0;
+}
+
+void UInteractionPickupPoolSubsystem::LogStats() const
+{
+	const int32 Total = NumHits + NumMisses;
+	UE_LOG(LogInteractionFramework, Log, TEXT("PickupPool: %d hits, %d misses (%.1f%% hit rate), %d pooled"),
+		NumHits, NumMisses, Total > 0 ? 100.f * NumHits / Total : 0.f, NumPooled);
+
+	for (const TPair<TObjectPtr<UClass>, FInteractionPickupPool>& Pair : Pools)
+	{
+		UE_LOG(LogInteractionFramework, Log, TEXT("  %s: %d / %d"),
+			*GetNameSafe(Pair.Key), Pair.Value.Free.Num(), GetCapacity(Pair.Key));
+	}
+}
@@ -0,0 +1,79 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractionPickupPoolSubsystem.generated.h"
+
+class AInteractablePickupActor;
+
+USTRUCT()
+struct FInteractionPickupPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AInteractablePickupActor>> Free;
+};
+
+/**
+ * UInteractionPickupPoolSubsystem
+ *
+ * Per-world, per-class pools of consumed pickups. AcquirePickup reuses a pooled pickup when one is available
+ * (hit) and spawns a new one otherwise (miss), so respawning pickups do not churn actor spawns, GC and
+ * registry registration.
+ *
+ * Pool capacity comes from the class's PoolSize, or Interaction.PickupPool.MaxPerClass when it is negative.
+ * Hits, misses and pooled counts are shown by "stat Interaction" and Interaction.PickupPool.Stats.
+ */
+UCLASS()
+class INTERACTIONFRAMEWORK_API UInteractionPickupPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UInteractionPickupPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/** Returns a pooled pickup of the class placed at Transform, or spawns one when the pool is empty. */
+	UFUNCTION(BlueprintCallable, Category="Interaction|Pickup", meta=(DeterminesOutputType="PickupClass"))
+	AInteractablePickupActor* AcquirePickup(TSubclassOf<AInteractablePickupActor> PickupClass, const FTransform& Transform);
+
+	/** Deactivates the pickup into its class pool. Returns false when the pool is full (the caller destroys it). */
+	bool ReleasePickup(AInteractablePickupActor* Pickup);
+
+	/** Takes a specific pooled pickup out of its pool and activates it where it was consumed (e.g. after loading a save). */
+	bool ReactivatePickup(AInteractablePickupActor* Pickup);
+
+	void GetPooledPickups(TArray<AInteractablePickupActor*>& OutPickups) const;
+
+	/** Spawns pooled pickups up to Count so the first respawns are hits. */
+	UFUNCTION(BlueprintCallable, Category="Interaction|Pickup")
+	void Prewarm(TSubclassOf<AInteractablePickupActor> PickupClass, int32 Count);
+
+	UFUNCTION(BlueprintPure, Category="Interaction|Pickup")
+	int32 GetNumPooled(TSubclassOf<AInteractablePickupActor> PickupClass) const;
+
+	UFUNCTION(BlueprintPure, Category="Interaction|Pickup")
+	int32 GetNumHits() const { return NumHits; }
+
+	UFUNCTION(BlueprintPure, Category="Interaction|Pickup")
+	int32 GetNumMisses() const { return NumMisses; }
+
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FInteractionPickupPool> Pools;
+
+	int32 NumHits = 0;
+	int32 NumMisses = 0;
+	int32 NumPooled = 0;
+
+	static int32 GetCapacity(const UClass* PickupClass);
+	AInteractablePickupActor* SpawnPickup(UClass* PickupClass, const FTransform& Transform) const;
+};
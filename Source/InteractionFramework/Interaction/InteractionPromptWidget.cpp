@@ -0,0 +1,30 @@
+#include "InteractionPromptWidget.h"
+
+void UInteractionPromptWidget::ApplyQueryChanges(const FInteractionQueryResult& Query, EInteractionQueryChange Changes)
+{
+	if (!EnumHasAnyFlags(Changes, EInteractionQueryChange::Content))
+	{
+		return;
+	}
+
+	if (!bUseFieldUpdates)
+	{
+		BP_SetQueryResult(Query);
+		return;
+	}
+
+	if (EnumHasAnyFlags(Changes, EInteractionQueryChange::PromptText))
+	{
+		BP_SetPromptText(Query.PromptText);
+	}
+
+	if (EnumHasAnyFlags(Changes, EInteractionQueryChange::InputType))
+	{
+		BP_SetInputType(Query.InputType, Query.HoldDuration);
+	}
+
+	if (EnumHasAnyFlags(Changes, EInteractionQueryChange::Requirements))
+	{
+		BP_SetRequirements(Query.UnmetRequirementMessages, Query.UnmetRequirementNumber, Query.bShouldShowRequirements);
+	}
+}
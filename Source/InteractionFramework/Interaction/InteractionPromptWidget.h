@@ -2,11 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Interaction/Data/InteractionTypes.h"
 #include "InteractionPromptWidget.generated.h"
 
 /**
  * Base class for the interaction prompt UI.
  * BP subclass is responsible for presentation; C++ pushes state via events.
+ *
+ * The owning controller diffs query results and only calls ApplyQueryChanges with the fields that changed.
+ * By default the whole query is forwarded to BP_SetQueryResult; widgets that enable bUseFieldUpdates
+ * receive the per-field events instead, so unchanged parts of the prompt are never invalidated.
  */
 UCLASS(Abstract)
 class INTERACTIONFRAMEWORK_API UInteractionPromptWidget : public UUserWidget
@@ -14,10 +19,25 @@ class INTERACTIONFRAMEWORK_API UInteractionPromptWidget : public UUserWidget
 	GENERATED_BODY()
 
 public:
+	/** Pushes the changed parts of a (visible) query to the widget. */
+	virtual void ApplyQueryChanges(const FInteractionQueryResult& Query, EInteractionQueryChange Changes);
+
 	/** Called when the focused interactable query data changes. */
 	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|UI")
 	void BP_SetQueryResult(const FInteractionQueryResult& Query);
 
+	/** Called when only the prompt text changed (bUseFieldUpdates). */
+	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|UI")
+	void BP_SetPromptText(const FText& PromptText);
+
+	/** Called when the input type or hold duration changed (bUseFieldUpdates). */
+	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|UI")
+	void BP_SetInputType(EInteractionInputType InputType, float HoldDuration);
+
+	/** Called when the unmet requirement list changed (bUseFieldUpdates). */
+	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|UI")
+	void BP_SetRequirements(const TArray<FText>& UnmetMessages, int32 UnmetNumber, bool bShouldShowRequirements);
+
 	/** Called while holding (0..1). */
 	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|UI")
 	void BP_SetHoldProgress(float NormalizedProgress);
@@ -25,4 +45,9 @@ public:
 	/** Show/hide the prompt widget. */
 	UFUNCTION(BlueprintImplementableEvent, Category="Interaction|UI")
 	void BP_SetPromptVisible(bool bVisible);
+
+protected:
+	/** Receive per-field events instead of the full BP_SetQueryResult. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interaction|UI")
+	bool bUseFieldUpdates = false;
 };
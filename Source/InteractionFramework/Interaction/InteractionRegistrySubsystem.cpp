@@ -0,0 +1,395 @@
+#include "InteractionRegistrySubsystem.h"
+#include "Interactable.h"
+#include "InteractionComponent.h"
+#include "InteractionStats.h"
+#include "InteractionUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+static TAutoConsoleVariable<bool> CVarSignificanceEnabled(
+	TEXT("Interaction.Significance.Enabled"),
+	true,
+	TEXT("Assign LOD tiers to interactables based on distance and visibility to local interactors. When off everything is Near."));
+
+static TAutoConsoleVariable<int32> CVarSignificanceBudget(
+	TEXT("Interaction.Significance.Budget"),
+	256,
+	TEXT("Max interactables re-evaluated by the significance pass per frame."));
+
+static TAutoConsoleVariable<float> CVarSignificanceNearDistance(
+	TEXT("Interaction.Significance.NearDistance"),
+	1500.f,
+	TEXT("Effective distance (cm) up to which interactables are in the Near tier."));
+
+static TAutoConsoleVariable<float> CVarSignificanceMidDistance(
+	TEXT("Interaction.Significance.MidDistance"),
+	4000.f,
+	TEXT("Effective distance (cm) up to which interactables are in the Mid tier. Beyond it they are Far."));
+
+static TAutoConsoleVariable<float> CVarSignificanceHiddenScale(
+	TEXT("Interaction.Significance.HiddenScale"),
+	2.f,
+	TEXT("Distance multiplier for interactables outside an interactor's view cone."));
+
+static TAutoConsoleVariable<float> CVarSignificanceViewHalfAngle(
+	TEXT("Interaction.Significance.ViewHalfAngle"),
+	60.f,
+	TEXT("Half angle (degrees) of the view cone used as the visibility test."));
+
+static TAutoConsoleVariable<bool> CVarDeferredInitEnabled(
+	TEXT("Interaction.DeferredInit.Enabled"),
+	true,
+	TEXT("Initialize interactable state in time-sliced batches after BeginPlay instead of inside it."));
+
+static TAutoConsoleVariable<float> CVarDeferredInitBudgetMs(
+	TEXT("Interaction.DeferredInit.BudgetMs"),
+	1.f,
+	TEXT("Max game thread time (ms) spent per frame on deferred interactable initialization. At least one runs per frame."));
+
+namespace
+{
+	/** Serialized size of the interactable and its direct subobjects. Skipped without stats, it walks every property. */
+	SIZE_T MeasureInteractableMemory(UObject* Interactable)
+	{
+#if STATS
+		FResourceSizeEx ResourceSize(EResourceSizeMode::EstimatedTotal);
+		Interactable->GetResourceSizeEx(ResourceSize);
+		return ResourceSize.GetTotalMemoryBytes();
+#else
+		return 0;
+#endif
+	}
+}
+
+UInteractionRegistrySubsystem* UInteractionRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionRegistrySubsystem>() : nullptr;
+}
+
+bool UInteractionRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UInteractionRegistrySubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_InteractionRegistryTick);
+}
+
+void UInteractionRegistrySubsystem::Deinitialize()
+{
+	for (int32 Tier = 0; Tier < UE_ARRAY_COUNT(TierCounts); ++Tier)
+	{
+		TierCounts[Tier] = 0;
+	}
+	UpdateTierStats();
+
+	DEC_DWORD_STAT_BY(STAT_InteractionRegisteredCount, Interactables.Num());
+	DEC_MEMORY_STAT_BY(STAT_InteractionRegisteredMemory, ReportedInteractableMemory);
+	DEC_MEMORY_STAT_BY(STAT_InteractionRegistryMemory, ReportedRegistryMemory);
+	ReportedInteractableMemory = 0;
+	ReportedRegistryMemory = 0;
+
+	SET_DWORD_STAT(STAT_InteractionPendingInit, 0);
+	PendingInit.Empty();
+
+	Interactables.Empty();
+	IndexByObject.Empty();
+	ObjectKeys.Empty();
+	Tiers.Empty();
+	InteractableMemory.Empty();
+	Interactors.Empty();
+	Viewers.Empty();
+	SignificanceCursor = 0;
+
+	Super::Deinitialize();
+}
+
+void UInteractionRegistrySubsystem::RegisterInteractable(UObject* Interactable)
+{
+	if (!IsValid(Interactable) || IndexByObject.Contains(Interactable))
+	{
+		return;
+	}
+
+	IndexByObject.Add(Interactable, Interactables.Add(Interactable));
+	ObjectKeys.Add(Interactable);
+
+	// New interactables start at full behavior until the significance pass reaches them.
+	Tiers.Add(EInteractionLodTier::Near);
+	++TierCounts[static_cast<uint8>(EInteractionLodTier::Near)];
+
+	const SIZE_T InstanceSize = MeasureInteractableMemory(Interactable);
+	InteractableMemory.Add(InstanceSize);
+	ReportedInteractableMemory += InstanceSize;
+	INC_DWORD_STAT(STAT_InteractionRegisteredCount);
+	INC_MEMORY_STAT_BY(STAT_InteractionRegisteredMemory, InstanceSize);
+
+	UpdateRegistryMemoryStat();
+	OnInteractableRegistered.Broadcast(Interactable);
+}
+
+void UInteractionRegistrySubsystem::UnregisterInteractable(UObject* Interactable)
+{
+	if (!IndexByObject.Contains(Interactable))
+	{
+		return;
+	}
+
+	// Listeners still see the interactable as registered, so they can look up its entry before it goes.
+	OnInteractableUnregistered.Broadcast(Interactable);
+
+	int32 Index = INDEX_NONE;
+	if (!IndexByObject.RemoveAndCopyValue(Interactable, Index))
+	{
+		return;
+	}
+
+	--TierCounts[static_cast<uint8>(Tiers[Index])];
+	const SIZE_T InstanceSize = InteractableMemory[Index];
+	Tiers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	InteractableMemory.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Interactables.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ObjectKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (ObjectKeys.IsValidIndex(Index))
+	{
+		// Fix up the index of the entry that was swapped into place, by key since its object may already be gone.
+		IndexByObject.FindChecked(ObjectKeys[Index]) = Index;
+	}
+
+	ReportedInteractableMemory -= FMath::Min(ReportedInteractableMemory, InstanceSize);
+	DEC_DWORD_STAT(STAT_InteractionRegisteredCount);
+	DEC_MEMORY_STAT_BY(STAT_InteractionRegisteredMemory, InstanceSize);
+
+	UpdateRegistryMemoryStat();
+}
+
+void UInteractionRegistrySubsystem::UpdateRegistryMemoryStat()
+{
+	const SIZE_T NewSize = Interactables.GetAllocatedSize() + IndexByObject.GetAllocatedSize() + ObjectKeys.GetAllocatedSize()
+		+ Tiers.GetAllocatedSize() + InteractableMemory.GetAllocatedSize();
+	if (NewSize == ReportedRegistryMemory)
+	{
+		return;
+	}
+
+	DEC_MEMORY_STAT_BY(STAT_InteractionRegistryMemory, ReportedRegistryMemory);
+	INC_MEMORY_STAT_BY(STAT_InteractionRegistryMemory, NewSize);
+	ReportedRegistryMemory = NewSize;
+}
+
+void UInteractionRegistrySubsystem::RegisterInteractor(UInteractionComponent* Interactor)
+{
+	if (IsValid(Interactor))
+	{
+		Interactors.AddUnique(Interactor);
+	}
+}
+
+void UInteractionRegistrySubsystem::UnregisterInteractor(UInteractionComponent* Interactor)
+{
+	Interactors.RemoveSwap(Interactor);
+}
+
+EInteractionLodTier UInteractionRegistrySubsystem::GetLodTier(const UObject* Interactable) const
+{
+	const int32* Index = IndexByObject.Find(Interactable);
+	return Index ? Tiers[*Index] : EInteractionLodTier::Near;
+}
+
+void UInteractionRegistrySubsystem::NotifyStateChanged(UObject* Interactable)
+{
+	UInteractionRegistrySubsystem* Registry = Get(Interactable);
+	if (Registry && Registry->IsRegistered(Interactable))
+	{
+		Registry->OnInteractableStateChanged.Broadcast(Interactable);
+	}
+}
+
+void UInteractionRegistrySubsystem::RequestInitialization(UObject* Interactable)
+{
+	IInteractable* AsInteractable = Cast<IInteractable>(Interactable);
+	if (!AsInteractable || AsInteractable->IsInteractionInitialized()) return;
+
+	if (!CVarDeferredInitEnabled.GetValueOnGameThread())
+	{
+		AsInteractable->InitializeInteraction();
+		NotifyStateChanged(Interactable);
+		return;
+	}
+
+	PendingInit.Add(Interactable);
+	bPendingInitSorted = false;
+}
+
+void UInteractionRegistrySubsystem::EnsureInitialized(UObject* Interactable)
+{
+	IInteractable* AsInteractable = Cast<IInteractable>(Interactable);
+	if (AsInteractable && !AsInteractable->IsInteractionInitialized())
+	{
+		// The queue entry is skipped once reached.
+		AsInteractable->InitializeInteraction();
+		NotifyStateChanged(Interactable);
+	}
+}
+
+void UInteractionRegistrySubsystem::ProcessPendingInitialization()
+{
+	if (PendingInit.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_InteractionDeferredInit);
+
+	if (!bPendingInitSorted)
+	{
+		SortPendingInitialization();
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + FMath::Max(CVarDeferredInitBudgetMs.GetValueOnGameThread(), 0.f) / 1000.0;
+	bool bInitializedAny = false;
+
+	while (PendingInit.Num() > 0 && (!bInitializedAny || FPlatformTime::Seconds() < EndTime))
+	{
+		UObject* Object = PendingInit.Pop(EAllowShrinking::No).Get();
+		IInteractable* Interactable = Cast<IInteractable>(Object);
+		if (!Interactable || Interactable->IsInteractionInitialized()) continue;
+
+		Interactable->InitializeInteraction();
+		OnInteractableStateChanged.Broadcast(Object);
+		bInitializedAny = true;
+		INC_DWORD_STAT(STAT_InteractionDeferredInitCount);
+	}
+
+	if (PendingInit.Num() == 0)
+	{
+		PendingInit.Empty();
+	}
+	SET_DWORD_STAT(STAT_InteractionPendingInit, PendingInit.Num());
+}
+
+void UInteractionRegistrySubsystem::SortPendingInitialization()
+{
+	bPendingInitSorted = true;
+
+	// Without a local interactor keep queue order.
+	if (Viewers.Num() == 0) return;
+
+	TArray<TPair<double, TWeakObjectPtr<UObject>>> Keyed;
+	Keyed.Reserve(PendingInit.Num());
+	for (const TWeakObjectPtr<UObject>& Pending : PendingInit)
+	{
+		const FVector Location = InteractionUtils::GetInteractableLocation(Pending.Get());
+		double BestDistSq = TNumericLimits<double>::Max();
+		for (const FViewer& Viewer : Viewers)
+		{
+			BestDistSq = FMath::Min(BestDistSq, FVector::DistSquared(Location, Viewer.Location));
+		}
+		Keyed.Emplace(BestDistSq, Pending);
+	}
+
+	// Farthest first, so popping from the back yields the nearest.
+	Keyed.StableSort([](const TPair<double, TWeakObjectPtr<UObject>>& A, const TPair<double, TWeakObjectPtr<UObject>>& B)
+	{
+		return A.Key > B.Key;
+	});
+
+	for (int32 i = 0; i < Keyed.Num(); ++i)
+	{
+		PendingInit[i] = Keyed[i].Value;
+	}
+}
+
+void UInteractionRegistrySubsystem::Tick(float DeltaTime)
+{
+	// The whole tick is counted under STAT_InteractionRegistryTick through GetStatId.
+	GatherViewers();
+	ProcessPendingInitialization();
+
+	if (Interactables.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_InteractionSignificance);
+
+	const int32 Budget = FMath::Min(FMath::Max(CVarSignificanceBudget.GetValueOnGameThread(), 1), Interactables.Num());
+	for (int32 i = 0; i < Budget; ++i)
+	{
+		SignificanceCursor = (SignificanceCursor + 1) % Interactables.Num();
+		SetTier(SignificanceCursor, EvaluateTier(Interactables[SignificanceCursor].Get()));
+	}
+
+	INC_DWORD_STAT_BY(STAT_InteractionSignificanceEvaluations, Budget);
+	UpdateTierStats();
+}
+
+void UInteractionRegistrySubsystem::GatherViewers()
+{
+	Viewers.Reset();
+
+	for (int32 i = Interactors.Num() - 1; i >= 0; --i)
+	{
+		const UInteractionComponent* Interactor = Interactors[i].Get();
+		if (!Interactor)
+		{
+			Interactors.RemoveAtSwap(i);
+			continue;
+		}
+
+		// Only what the local players see matters; AI and remote interactors do not keep cosmetics alive.
+		if (!Interactor->IsLocalPlayerInteractor()) continue;
+
+		FVector Location;
+		FRotator Rotation;
+		if (Interactor->GetViewPoint(Location, Rotation))
+		{
+			Viewers.Add({ Location, Rotation.Vector() });
+		}
+	}
+}
+
+EInteractionLodTier UInteractionRegistrySubsystem::EvaluateTier(const UObject* Interactable) const
+{
+	if (!Interactable || Viewers.Num() == 0 || !CVarSignificanceEnabled.GetValueOnGameThread())
+	{
+		return EInteractionLodTier::Near;
+	}
+
+	const FVector Location = InteractionUtils::GetInteractableLocation(Interactable);
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(CVarSignificanceViewHalfAngle.GetValueOnGameThread()));
+	const float HiddenScale = FMath::Max(CVarSignificanceHiddenScale.GetValueOnGameThread(), 1.f);
+
+	double BestDistance = TNumericLimits<double>::Max();
+	for (const FViewer& Viewer : Viewers)
+	{
+		const FVector ToActor = Location - Viewer.Location;
+		const double Distance = ToActor.Size();
+		const bool bInView = Distance <= UE_KINDA_SMALL_NUMBER || FVector::DotProduct(ToActor / Distance, Viewer.Forward) >= CosHalfAngle;
+		BestDistance = FMath::Min(BestDistance, bInView ? Distance : Distance * HiddenScale);
+	}
+
+	if (BestDistance <= CVarSignificanceNearDistance.GetValueOnGameThread()) return EInteractionLodTier::Near;
+	if (BestDistance <= CVarSignificanceMidDistance.GetValueOnGameThread()) return EInteractionLodTier::Mid;
+	return EInteractionLodTier::Far;
+}
+
+void UInteractionRegistrySubsystem::SetTier(int32 Index, EInteractionLodTier NewTier)
+{
+	const EInteractionLodTier OldTier = Tiers[Index];
+	if (OldTier == NewTier) return;
+
+	--TierCounts[static_cast<uint8>(OldTier)];
+	++TierCounts[static_cast<uint8>(NewTier)];
+	Tiers[Index] = NewTier;
+
+	if (IInteractable* Interactable = Cast<IInteractable>(Interactables[Index].Get()))
+	{
+		Interactable->OnInteractionLodChanged(NewTier);
+	}
+}
+
+void UInteractionRegistrySubsystem::UpdateTierStats() const
+{
+	SET_DWORD_STAT(STAT_InteractionTierNear, TierCounts[static_cast<uint8>(EInteractionLodTier::Near)]);
+	SET_DWORD_STAT(STAT_InteractionTierMid, TierCounts[static_cast<uint8>(EInteractionLodTier::Mid)]);
+	SET_DWORD_STAT(STAT_InteractionTierFar, TierCounts[static_cast<uint8>(EInteractionLodTier::Far)]);
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Interaction/Data/InteractionTypes.h"
+#include "InteractionRegistrySubsystem.generated.h"
+
+class UInteractionComponent;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractableRegistrationChanged, UObject* /*Interactable*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractableStateChanged, UObject* /*Interactable*/);
+
+/**
+ * UInteractionRegistrySubsystem
+ *
+ * Per-world list of the interactables currently participating in the interaction system.
+ * Interactables register themselves in BeginPlay and unregister in EndPlay. Entries are the objects implementing
+ * IInteractable: interactable actors, or the UInteractableComponent of an actor that is not itself interactable.
+ * InteractionUtils::GetInteractableActor maps an entry to its actor.
+ *
+ * Registration is O(1) both ways (swap removal), so the order of GetRegisteredInteractables() is not stable.
+ *
+ * Also runs the significance pass: every frame a budgeted slice of the interactables is assigned an
+ * EInteractionLodTier from its distance to the closest local interactor, with interactables outside the
+ * interactor's view counting as further away. With no local interactor everything stays Near.
+ *
+ * Interactables also queue their state initialization here instead of running it in BeginPlay. The queue is
+ * drained under a per-frame time budget, nearest to a local interactor first, so streaming in a large level
+ * does not initialize everything in one frame. Focused interactables are initialized on demand.
+ */
+UCLASS()
+class INTERACTIONFRAMEWORK_API UInteractionRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UInteractionRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterInteractable(UObject* Interactable);
+	void UnregisterInteractable(UObject* Interactable);
+
+	/** Broadcast after an interactable was added, and before a removed one is dropped (it is still valid then). */
+	FOnInteractableRegistrationChanged OnInteractableRegistered;
+	FOnInteractableRegistrationChanged OnInteractableUnregistered;
+
+	/**
+	 * Broadcast when a registered interactable's state, and with it its requirements and AI availability, may have
+	 * changed: after its initialization and whenever the server pushes a new state.
+	 */
+	FOnInteractableStateChanged OnInteractableStateChanged;
+
+	/** Broadcasts OnInteractableStateChanged. Cheap when nothing listens. */
+	static void NotifyStateChanged(UObject* Interactable);
+
+	bool IsRegistered(const UObject* Interactable) const { return IndexByObject.Contains(Interactable); }
+
+	const TArray<TWeakObjectPtr<UObject>>& GetRegisteredInteractables() const { return Interactables; }
+
+	UFUNCTION(BlueprintPure, Category="Interaction")
+	int32 GetNumRegisteredInteractables() const { return Interactables.Num(); }
+
+	/** Queues IInteractable::InitializeInteraction, or runs it now when deferred initialization is off. */
+	void RequestInitialization(UObject* Interactable);
+
+	/** Runs a still pending initialization immediately (e.g. the interactable got focused before its turn). */
+	static void EnsureInitialized(UObject* Interactable);
+
+	int32 GetNumPendingInitializations() const { return PendingInit.Num(); }
+
+	/** Interactors considered by the significance pass (only locally player-controlled ones are used). */
+	void RegisterInteractor(UInteractionComponent* Interactor);
+	void UnregisterInteractor(UInteractionComponent* Interactor);
+
+	/** Current tier of an interactable. Unregistered objects are Near. */
+	EInteractionLodTier GetLodTier(const UObject* Interactable) const;
+
+	int32 GetNumInTier(EInteractionLodTier Tier) const { return TierCounts[static_cast<uint8>(Tier)]; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FViewer
+	{
+		FVector Location;
+		FVector Forward;
+	};
+
+	TArray<TWeakObjectPtr<UObject>> Interactables;
+	TMap<const UObject*, int32> IndexByObject;
+
+	/** IndexByObject keys, parallel to Interactables. Kept raw so entries can be fixed up after their object died. */
+	TArray<const UObject*> ObjectKeys;
+
+	/** Parallel to Interactables. */
+	TArray<EInteractionLodTier> Tiers;
+
+	/** Estimated bytes of each interactable and its subobjects, measured once at registration. Parallel to Interactables. */
+	TArray<SIZE_T> InteractableMemory;
+	int32 TierCounts[static_cast<uint8>(EInteractionLodTier::Count)] = {};
+
+	/** Round-robin position of the budgeted significance pass. */
+	int32 SignificanceCursor = 0;
+
+	TArray<TWeakObjectPtr<UInteractionComponent>> Interactors;
+	TArray<FViewer> Viewers;
+
+	/** Deferred initializations, sorted so the nearest is last. Stale and already initialized entries are skipped. */
+	TArray<TWeakObjectPtr<UObject>> PendingInit;
+	bool bPendingInitSorted = true;
+
+	/** Bytes currently reported to the stats system. */
+	SIZE_T ReportedInteractableMemory = 0;
+	SIZE_T ReportedRegistryMemory = 0;
+
+	void UpdateRegistryMemoryStat();
+
+	void GatherViewers();
+	void ProcessPendingInitialization();
+	void SortPendingInitialization();
+	EInteractionLodTier EvaluateTier(const UObject* Interactable) const;
+	void SetTier(int32 Index, EInteractionLodTier NewTier);
+	void UpdateTierStats() const;
+};
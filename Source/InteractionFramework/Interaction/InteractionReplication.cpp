@@ -0,0 +1,120 @@
+#include "InteractionReplication.h"
+#include "Interactable.h"
+#include "InteractionStats.h"
+#include "HAL/IConsoleManager.h"
+
+namespace InteractionNet
+{
+	static int64 TotalChanges = 0;
+	static int64 TotalStateBits = 0;
+	static int64 TotalKeyringBits = 0;
+	static int64 TotalPredictions = 0;
+	static int64 TotalRejections = 0;
+
+	/** Size of a value written by SerializeIntPacked: 7 bits per byte. */
+	static int64 GetPackedBits(uint32 Value)
+	{
+		int64 Bytes = 1;
+		while (Value >= 0x80)
+		{
+			Value >>= 7;
+			++Bytes;
+		}
+		return Bytes * 8;
+	}
+
+	void RecordChange()
+	{
+		++TotalChanges;
+		INC_DWORD_STAT(STAT_InteractionNetChanges);
+	}
+
+	void RecordStateBits(int64 Bits)
+	{
+		TotalStateBits += Bits;
+		INC_DWORD_STAT_BY(STAT_InteractionNetStateBits, Bits);
+	}
+
+	void RecordKeyringBits(int64 Bits)
+	{
+		TotalKeyringBits += Bits;
+		INC_DWORD_STAT_BY(STAT_InteractionNetKeyringBits, Bits);
+	}
+
+	void RecordPrediction()
+	{
+		++TotalPredictions;
+		INC_DWORD_STAT(STAT_InteractionPredictions);
+	}
+
+	void RecordRejection()
+	{
+		++TotalRejections;
+		INC_DWORD_STAT(STAT_InteractionRejections);
+	}
+
+	void LogStats()
+	{
+		const int64 TotalBits = TotalStateBits + TotalKeyringBits;
+		UE_LOG(LogInteractionFramework, Display, TEXT("Interaction net: %lld changes, state %lld bytes, keyring %lld bytes, %.1f bytes per change"),
+			TotalChanges, TotalStateBits / 8, TotalKeyringBits / 8,
+			TotalChanges > 0 ? static_cast<double>(TotalBits) / 8.0 / static_cast<double>(TotalChanges) : 0.0);
+		UE_LOG(LogInteractionFramework, Display, TEXT("Interaction net: %lld predicted interacts, %lld rejected by the server"),
+			TotalPredictions, TotalRejections);
+	}
+
+	void ResetStats()
+	{
+		TotalChanges = 0;
+		TotalStateBits = 0;
+		TotalKeyringBits = 0;
+		TotalPredictions = 0;
+		TotalRejections = 0;
+	}
+}
+
+static FAutoConsoleCommand GNetStatsCommand(
+	TEXT("Interaction.Net.Stats"),
+	TEXT("Logs replicated interaction payload bytes (in total and per state change or key grant) and prediction counts."),
+	FConsoleCommandDelegate::CreateStatic(&InteractionNet::LogStats));
+
+static FAutoConsoleCommand GNetResetStatsCommand(
+	TEXT("Interaction.Net.ResetStats"),
+	TEXT("Resets the counters logged by Interaction.Net.Stats."),
+	FConsoleCommandDelegate::CreateStatic(&InteractionNet::ResetStats));
+
+bool FInteractionNetState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// Shifted by one so that INDEX_NONE packs to zero
+	uint32 Packed = static_cast<uint32>(StateIndex + 1);
+	Ar.SerializeIntPacked(Packed);
+
+	if (Ar.IsLoading())
+	{
+		StateIndex = static_cast<int16>(static_cast<int32>(Packed) - 1);
+	}
+	else
+	{
+		InteractionNet::RecordStateBits(InteractionNet::GetPackedBits(Packed));
+	}
+
+	bOutSuccess = true;
+	return true;
+}
+
+bool FInteractionRequest::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Ar << Target;
+
+	uint32 PackedItem = static_cast<uint32>(Item + 1);
+	Ar.SerializeIntPacked(PackedItem);
+	Ar << PredictionKey;
+
+	if (Ar.IsLoading())
+	{
+		Item = static_cast<int32>(PackedItem) - 1;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
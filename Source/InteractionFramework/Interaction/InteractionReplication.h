@@ -0,0 +1,87 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InteractionReplication.generated.h"
+
+/**
+ * FInteractionNetState
+ *
+ * Replicated state of an interactable (or one of its slots): the index of the state in its data asset
+ * rather than the state id. Serialized as a packed int, so a state change is one byte for the first 127 states.
+ * Every send is counted in the interaction net stats.
+ */
+USTRUCT()
+struct INTERACTIONFRAMEWORK_API FInteractionNetState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int16 StateIndex = INDEX_NONE;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FInteractionNetState& Other) const { return StateIndex == Other.StateIndex; }
+};
+
+template<>
+struct TStructOpsTypeTraits<FInteractionNetState> : public TStructOpsTypeTraitsBase2<FInteractionNetState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
+
+/**
+ * FInteractionRequest
+ *
+ * Interact request sent by a predicting client. Target is the object implementing IInteractable (an actor or
+ * one of its components). Item and prediction key are packed, so a request is the target's net GUID plus 3-7 bytes.
+ */
+USTRUCT()
+struct INTERACTIONFRAMEWORK_API FInteractionRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UObject> Target;
+
+	UPROPERTY()
+	int32 Item = INDEX_NONE;
+
+	/** Echoed back by the server's confirmation. Never 0. */
+	UPROPERTY()
+	uint16 PredictionKey = 0;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FInteractionRequest> : public TStructOpsTypeTraitsBase2<FInteractionRequest>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * Bandwidth accounting for interaction replication. Payload bits are summed over all connections and
+ * reported per change (an authority-side state change or key grant/removal) by Interaction.Net.Stats.
+ * Property headers and packet overhead are not included; use Network Insights for those.
+ */
+namespace InteractionNet
+{
+	INTERACTIONFRAMEWORK_API void RecordChange();
+	INTERACTIONFRAMEWORK_API void RecordStateBits(int64 Bits);
+	INTERACTIONFRAMEWORK_API void RecordKeyringBits(int64 Bits);
+
+	/** Client side: an interact was predicted, or the server rejected one. */
+	INTERACTIONFRAMEWORK_API void RecordPrediction();
+	INTERACTIONFRAMEWORK_API void RecordRejection();
+
+	INTERACTIONFRAMEWORK_API void LogStats();
+	INTERACTIONFRAMEWORK_API void ResetStats();
+}
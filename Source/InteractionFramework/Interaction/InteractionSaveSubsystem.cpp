@@ -0,0 +1,604 @@
+#include "InteractionSaveSubsystem.h"
+#include "Interactable.h"
+#include "InteractablePickupActor.h"
+#include "InteractionFramework.h"
+#include "InteractionPersistenceSubsystem.h"
+#include "InteractionPickupPoolSubsystem.h"
+#include "InteractionRegistrySubsystem.h"
+#include "KeyringComponent.h"
+#include "Interaction/Data/InteractionDataAsset.h"
+#include "Interaction/Data/NpcInteractionDataAsset.h"
+#include "Async/Async.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace InteractionSave
+{
+	constexpr uint32 Magic = 0x56415349; // "ISAV"
+	constexpr uint16 FormatVersion = 1;
+
+	static void GetStateIds(const UObject* DataAsset, TArray<FName>& OutStateIds)
+	{
+		if (const UInteractionDataAsset* Data = Cast<UInteractionDataAsset>(DataAsset))
+		{
+			for (const FInteractionStateDefinition& State : Data->States)
+			{
+				OutStateIds.Add(State.StateId);
+			}
+		}
+		else if (const UNpcInteractionDataAsset* NpcData = Cast<UNpcInteractionDataAsset>(DataAsset))
+		{
+			for (const FNpcDialogueState& State : NpcData->States)
+			{
+				OutStateIds.Add(State.StateId);
+			}
+		}
+	}
+
+	/** Stable across runs, unlike FName hashes. */
+	static uint32 GetVersionHash(const TArray<FName>& StateIds)
+	{
+		uint32 Hash = 0;
+		for (const FName& StateId : StateIds)
+		{
+			Hash = FCrc::StrCrc32(*StateId.ToString(), Hash);
+		}
+		return Hash;
+	}
+}
+
+static TAutoConsoleVariable<int32> CVarSaveMaxDeltas(
+	TEXT("Interaction.Save.MaxDeltas"),
+	32,
+	TEXT("Delta checkpoints appended to a slot before the next checkpoint is written full."));
+
+static TAutoConsoleVariable<int32> CVarSaveMaxSlotKB(
+	TEXT("Interaction.Save.MaxSlotKB"),
+	1024,
+	TEXT("Slot file size in KB after which the next checkpoint is written full."));
+
+static FAutoConsoleCommandWithWorldAndArgs GSaveCheckpointCommand(
+	TEXT("Interaction.Save"),
+	TEXT("Writes an interaction checkpoint. Usage: Interaction.Save <Slot> [full]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInteractionSaveSubsystem* Save = UInteractionSaveSubsystem::Get(World))
+		{
+			const bool bFull = Args.Num() > 1 && Args[1].Equals(TEXT("full"), ESearchCase::IgnoreCase);
+			Save->SaveCheckpoint(Args.Num() > 0 ? Args[0] : TEXT("Default"), !bFull);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GLoadSlotCommand(
+	TEXT("Interaction.Load"),
+	TEXT("Loads an interaction save slot. Usage: Interaction.Load <Slot>"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInteractionSaveSubsystem* Save = UInteractionSaveSubsystem::Get(World))
+		{
+			Save->LoadSlot(Args.Num() > 0 ? Args[0] : TEXT("Default"));
+		}
+	}));
+
+UInteractionSaveSubsystem* UInteractionSaveSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionSaveSubsystem>() : nullptr;
+}
+
+bool UInteractionSaveSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UInteractionSaveSubsystem::Deinitialize()
+{
+	if (PendingLoad.IsValid())
+	{
+		PendingLoad->CancelHandle();
+		PendingLoad.Reset();
+	}
+	FlushWrites();
+	Super::Deinitialize();
+}
+
+FString UInteractionSaveSubsystem::GetSlotPath(const FString& SlotName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("Interaction") / TEXT("SaveGames") / (SlotName + TEXT(".isav"));
+}
+
+void UInteractionSaveSubsystem::FlushWrites()
+{
+	if (WriteTask.IsValid())
+	{
+		WriteTask.Wait();
+	}
+}
+
+void UInteractionSaveSubsystem::GatherKeyrings(TArray<UKeyringComponent*>& OutKeyrings) const
+{
+	const UWorld* World = GetWorld();
+	if (!World) return;
+
+	// Indexed by local player order; players without a keyring keep their slot.
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || !PC->IsLocalController()) continue;
+
+		const APawn* Pawn = PC->GetPawn();
+		OutKeyrings.Add(Pawn ? Pawn->FindComponentByClass<UKeyringComponent>() : nullptr);
+	}
+}
+
+void UInteractionSaveSubsystem::RecordLiveInteractables() const
+{
+	UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this);
+	const UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this);
+	if (!Persistence || !Registry) return;
+
+	for (const TWeakObjectPtr<UObject>& Weak : Registry->GetRegisteredInteractables())
+	{
+		if (const IInteractable* Interactable = Cast<IInteractable>(Weak.Get()))
+		{
+			Persistence->Record(*Interactable);
+		}
+	}
+}
+
+void UInteractionSaveSubsystem::RestoreLiveInteractables() const
+{
+	const UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this);
+	const UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this);
+	if (!Persistence || !Registry) return;
+
+	// Copy: restoring a consumed pickup unregisters it.
+	const TArray<TWeakObjectPtr<UObject>> Interactables = Registry->GetRegisteredInteractables();
+	for (const TWeakObjectPtr<UObject>& Weak : Interactables)
+	{
+		// Pending ones restore themselves when their deferred initialization runs.
+		IInteractable* Interactable = Cast<IInteractable>(Weak.Get());
+		if (Interactable && Interactable->IsInteractionInitialized())
+		{
+			Persistence->Restore(*Interactable);
+		}
+	}
+}
+
+void UInteractionSaveSubsystem::RestorePooledPickups() const
+{
+	const UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this);
+	UInteractionPickupPoolSubsystem* Pool = UInteractionPickupPoolSubsystem::Get(this);
+	if (!Persistence || !Pool) return;
+
+	TArray<AInteractablePickupActor*> Pooled;
+	Pool->GetPooledPickups(Pooled);
+
+	// Placed pickups consumed after the save was written are back in the world at the time of the save.
+	for (AInteractablePickupActor* Pickup : Pooled)
+	{
+		const FGuid PersistentId = Pickup->GetPersistentId();
+		if (!PersistentId.IsValid()) continue;
+
+		const UInteractionPersistenceSubsystem::FRow* Row = Persistence->FindRow(PersistentId);
+		if (!Row || !EnumHasAnyFlags(Row->Flags, EInteractionPersistFlags::Consumed))
+		{
+			Pool->ReactivatePickup(Pickup);
+		}
+	}
+}
+
+void UInteractionSaveSubsystem::UpdateSavedKeyringRevisions(const TArray<UKeyringComponent*>& Keyrings)
+{
+	SavedKeyringRevisions.SetNumZeroed(Keyrings.Num());
+	for (int32 i = 0; i < Keyrings.Num(); ++i)
+	{
+		SavedKeyringRevisions[i] = Keyrings[i] ? Keyrings[i]->GetRevision() : 0;
+	}
+}
+
+void UInteractionSaveSubsystem::SaveCheckpoint(const FString& SlotName, bool bDelta)
+{
+	UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this);
+	if (!Persistence || SlotName.IsEmpty()) return;
+
+	const bool bCompact = NumSlotDeltas >= CVarSaveMaxDeltas.GetValueOnGameThread()
+		|| SlotSize >= static_cast<int64>(CVarSaveMaxSlotKB.GetValueOnGameThread()) * 1024;
+	const bool bFull = !bDelta || bNeedsFullSave || BaseSlotName != SlotName || bCompact;
+
+	RecordLiveInteractables();
+
+	TArray<UKeyringComponent*> Keyrings;
+	GatherKeyrings(Keyrings);
+
+	FChunkData Chunk;
+	BuildChunk(bFull ? EChunkType::Full : EChunkType::Delta, Keyrings, Chunk);
+
+	Persistence->ClearDirty();
+	UpdateSavedKeyringRevisions(Keyrings);
+	BaseSlotName = SlotName;
+	bNeedsFullSave = false;
+	NumSlotDeltas = bFull ? 0 : NumSlotDeltas + 1;
+	if (bFull)
+	{
+		// The write task adds the chunk's size once it is on disk.
+		SlotSize = 0;
+		++SlotGeneration;
+	}
+
+	QueueWrite(GetSlotPath(SlotName), MoveTemp(Chunk), !bFull);
+}
+
+void UInteractionSaveSubsystem::BuildChunk(EChunkType Type, const TArray<UKeyringComponent*>& Keyrings, FChunkData& OutChunk) const
+{
+	const UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this);
+	const bool bFull = Type == EChunkType::Full;
+	OutChunk.Type = Type;
+
+	// Keyrings that changed, and the key table their bitsets index into
+	TMap<FName, int32> KeyIndices;
+	for (int32 i = 0; i < Keyrings.Num() && i <= MAX_uint8; ++i)
+	{
+		const UKeyringComponent* Keyring = Keyrings[i];
+		if (!Keyring) continue;
+		if (!bFull && SavedKeyringRevisions.IsValidIndex(i) && SavedKeyringRevisions[i] == Keyring->GetRevision()) continue;
+
+		OutChunk.KeyringPlayers.Add(static_cast<uint8>(i));
+		for (const FName& KeyId : Keyring->GetOwnedKeys())
+		{
+			if (!KeyIndices.Contains(KeyId))
+			{
+				KeyIndices.Add(KeyId, OutChunk.Keys.Add(KeyId));
+			}
+		}
+	}
+
+	for (const uint8 PlayerIndex : OutChunk.KeyringPlayers)
+	{
+		TBitArray<>& Bits = OutChunk.KeyringBits.Emplace_GetRef(false, OutChunk.Keys.Num());
+		for (const FName& KeyId : Keyrings[PlayerIndex]->GetOwnedKeys())
+		{
+			Bits[KeyIndices.FindChecked(KeyId)] = true;
+		}
+	}
+
+	// Interactable rows, with the data assets they reference remapped to a chunk-local table
+	const TArray<UInteractionPersistenceSubsystem::FRow>& Rows = Persistence->GetRows();
+	const TArray<TWeakObjectPtr<const UObject>>& TableAssets = Persistence->GetDataAssets();
+	TArray<int32> ChunkAssetByTableAsset;
+	ChunkAssetByTableAsset.Init(INDEX_NONE, TableAssets.Num());
+
+	for (const TPair<FGuid, int32>& Pair : Persistence->GetRowIndices())
+	{
+		if (!bFull && !Persistence->IsRowDirty(Pair.Value)) continue;
+
+		const UInteractionPersistenceSubsystem::FRow& Row = Rows[Pair.Value];
+
+		uint16 ChunkAsset = UInteractionPersistenceSubsystem::NoAsset;
+		if (TableAssets.IsValidIndex(Row.AssetIndex))
+		{
+			int32& Mapped = ChunkAssetByTableAsset[Row.AssetIndex];
+			if (Mapped == INDEX_NONE)
+			{
+				const UObject* Asset = TableAssets[Row.AssetIndex].Get();
+				Mapped = OutChunk.AssetPaths.Add(Asset ? FSoftObjectPath(Asset).ToString() : FString());
+				InteractionSave::GetStateIds(Asset, OutChunk.AssetStateIds.AddDefaulted_GetRef());
+			}
+			ChunkAsset = static_cast<uint16>(Mapped);
+		}
+
+		OutChunk.Ids.Add(Pair.Key);
+		OutChunk.AssetIndices.Add(ChunkAsset);
+		OutChunk.StateIndices.Add(Row.StateIndex);
+		OutChunk.Flags.Add(static_cast<uint8>(Row.Flags));
+	}
+}
+
+TArray<uint8> UInteractionSaveSubsystem::SerializeChunk(FChunkData& Chunk)
+{
+	// Payload
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+	FNameAsStringProxyArchive Ar(PayloadWriter);
+
+	Ar << Chunk.Keys;
+
+	int32 NumAssets = Chunk.AssetPaths.Num();
+	Ar << NumAssets;
+	for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+	{
+		uint32 VersionHash = InteractionSave::GetVersionHash(Chunk.AssetStateIds[AssetIndex]);
+		Ar << Chunk.AssetPaths[AssetIndex] << VersionHash << Chunk.AssetStateIds[AssetIndex];
+	}
+
+	int32 NumKeyrings = Chunk.KeyringPlayers.Num();
+	Ar << NumKeyrings;
+	for (int32 i = 0; i < NumKeyrings; ++i)
+	{
+		Ar << Chunk.KeyringPlayers[i] << Chunk.KeyringBits[i];
+	}
+
+	Ar << Chunk.Ids << Chunk.AssetIndices << Chunk.StateIndices << Chunk.Flags;
+
+	// Header
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = InteractionSave::Magic;
+	uint16 Version = InteractionSave::FormatVersion;
+	uint8 ChunkType = static_cast<uint8>(Chunk.Type);
+	int64 PayloadSize = Payload.Num();
+	Writer << Magic << Version << ChunkType << PayloadSize;
+	Writer.Serialize(Payload.GetData(), Payload.Num());
+
+	return Bytes;
+}
+
+void UInteractionSaveSubsystem::QueueWrite(const FString& Path, FChunkData&& Chunk, bool bAppend)
+{
+	TWeakObjectPtr<UInteractionSaveSubsystem> WeakThis(this);
+	auto Write = [Path, Chunk = MoveTemp(Chunk), bAppend, WeakThis, Generation = SlotGeneration]() mutable
+	{
+		const TArray<uint8> Bytes = SerializeChunk(Chunk);
+		const uint32 WriteFlags = bAppend ? FILEWRITE_Append : FILEWRITE_None;
+		if (FFileHelper::SaveArrayToFile(Bytes, *Path, &IFileManager::Get(), WriteFlags))
+		{
+			UE_LOG(LogInteractionFramework, Log, TEXT("Interaction save: %s checkpoint to %s (%d bytes)"),
+				bAppend ? TEXT("delta") : TEXT("full"), *Path, Bytes.Num());
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Size = Bytes.Num()]()
+			{
+				UInteractionSaveSubsystem* This = WeakThis.Get();
+				if (This && This->SlotGeneration == Generation)
+				{
+					This->SlotSize += Size;
+				}
+			});
+			return;
+		}
+
+		UE_LOG(LogInteractionFramework, Error, TEXT("Interaction save: failed to write %s"), *Path);
+
+		// The chunk is lost, so the next checkpoint must not be a delta on top of it.
+		AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+		{
+			if (UInteractionSaveSubsystem* This = WeakThis.Get())
+			{
+				This->bNeedsFullSave = true;
+			}
+		});
+	};
+
+	WriteTask = WriteTask.IsValid()
+		? UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Write), UE::Tasks::Prerequisites(WriteTask))
+		: UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Write));
+}
+
+bool UInteractionSaveSubsystem::LoadSlot(const FString& SlotName)
+{
+	if (!UInteractionPersistenceSubsystem::Get(this)) return false;
+
+	FlushWrites();
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetSlotPath(SlotName)))
+	{
+		UE_LOG(LogInteractionFramework, Warning, TEXT("Interaction save: slot %s not found"), *SlotName);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	FNameAsStringProxyArchive Ar(Reader);
+
+	// Everything is read before anything is applied, so a corrupt chunk cannot leave half of itself behind.
+	TArray<FChunkData> Chunks;
+	while (!Ar.AtEnd())
+	{
+		if (!ReadChunk(Ar, Chunks.AddDefaulted_GetRef()))
+		{
+			// Keep what was read; a torn final delta only loses that delta.
+			Chunks.Pop();
+			UE_LOG(LogInteractionFramework, Warning, TEXT("Interaction save: %s is corrupt after %d chunks"), *SlotName, Chunks.Num());
+			break;
+		}
+	}
+
+	if (Chunks.Num() == 0) return false;
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	for (const FChunkData& Chunk : Chunks)
+	{
+		for (const FString& Path : Chunk.AssetPaths)
+		{
+			const FSoftObjectPath AssetPath(Path);
+			if (!Path.IsEmpty() && !AssetPath.ResolveObject())
+			{
+				AssetsToLoad.AddUnique(AssetPath);
+			}
+		}
+	}
+
+	// A newer load replaces one still waiting for its assets.
+	if (PendingLoad.IsValid())
+	{
+		PendingLoad->CancelHandle();
+		PendingLoad.Reset();
+	}
+
+	const int64 SlotBytes = Bytes.Num();
+	if (AssetsToLoad.Num() == 0)
+	{
+		ApplySlot(Chunks, SlotName, SlotBytes);
+		return true;
+	}
+
+	PendingLoad = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetsToLoad),
+		FStreamableDelegate::CreateWeakLambda(this, [this, Chunks = MoveTemp(Chunks), SlotName, SlotBytes]()
+		{
+			PendingLoad.Reset();
+			ApplySlot(Chunks, SlotName, SlotBytes);
+		}));
+	return true;
+}
+
+void UInteractionSaveSubsystem::ApplySlot(const TArray<FChunkData>& Chunks, const FString& SlotName, int64 SlotBytes)
+{
+	UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this);
+	if (!Persistence) return;
+
+	TArray<UKeyringComponent*> Keyrings;
+	GatherKeyrings(Keyrings);
+
+	for (const FChunkData& Chunk : Chunks)
+	{
+		ApplyChunk(Chunk, Keyrings);
+	}
+
+	// Un-pooled pickups register again, so they are restored with the rest.
+	RestorePooledPickups();
+	RestoreLiveInteractables();
+
+	Persistence->ClearDirty();
+	UpdateSavedKeyringRevisions(Keyrings);
+	BaseSlotName = SlotName;
+	bNeedsFullSave = false;
+
+	// A slot is one full checkpoint followed by its deltas.
+	NumSlotDeltas = Chunks.Num() - 1;
+	SlotSize = SlotBytes;
+	++SlotGeneration;
+}
+
+bool UInteractionSaveSubsystem::ReadChunk(FArchive& Ar, FChunkData& OutChunk)
+{
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	uint8 ChunkType = 0;
+	int64 PayloadSize = 0;
+	Ar << Magic << Version << ChunkType << PayloadSize;
+
+	if (Ar.IsError() || Magic != InteractionSave::Magic || Version > InteractionSave::FormatVersion
+		|| ChunkType > static_cast<uint8>(EChunkType::Delta) || PayloadSize < 0 || Ar.Tell() + PayloadSize > Ar.TotalSize())
+	{
+		return false;
+	}
+
+	const int64 PayloadEnd = Ar.Tell() + PayloadSize;
+	OutChunk.Type = static_cast<EChunkType>(ChunkType);
+
+	Ar << OutChunk.Keys;
+
+	int32 NumAssets = 0;
+	Ar << NumAssets;
+	if (NumAssets < 0 || NumAssets > UInteractionPersistenceSubsystem::NoAsset) return false;
+
+	OutChunk.AssetPaths.SetNum(NumAssets);
+	OutChunk.AssetVersionHashes.SetNum(NumAssets);
+	OutChunk.AssetStateIds.SetNum(NumAssets);
+	for (int32 AssetIndex = 0; AssetIndex < NumAssets && !Ar.IsError() && Ar.Tell() <= PayloadEnd; ++AssetIndex)
+	{
+		Ar << OutChunk.AssetPaths[AssetIndex] << OutChunk.AssetVersionHashes[AssetIndex] << OutChunk.AssetStateIds[AssetIndex];
+	}
+
+	int32 NumKeyrings = 0;
+	Ar << NumKeyrings;
+	if (NumKeyrings < 0 || NumKeyrings > MAX_uint8 + 1) return false;
+
+	OutChunk.KeyringPlayers.SetNum(NumKeyrings);
+	OutChunk.KeyringBits.SetNum(NumKeyrings);
+	for (int32 i = 0; i < NumKeyrings && !Ar.IsError() && Ar.Tell() <= PayloadEnd; ++i)
+	{
+		Ar << OutChunk.KeyringPlayers[i] << OutChunk.KeyringBits[i];
+	}
+
+	Ar << OutChunk.Ids << OutChunk.AssetIndices << OutChunk.StateIndices << OutChunk.Flags;
+
+	// The payload must end exactly where its header said, or the next chunk would be read from the wrong offset.
+	const int32 NumRows = OutChunk.Ids.Num();
+	return !Ar.IsError() && Ar.Tell() == PayloadEnd && OutChunk.AssetIndices.Num() == NumRows
+		&& OutChunk.StateIndices.Num() == NumRows && OutChunk.Flags.Num() == NumRows;
+}
+
+void UInteractionSaveSubsystem::ApplyChunk(const FChunkData& Chunk, const TArray<UKeyringComponent*>& Keyrings)
+{
+	UInteractionPersistenceSubsystem* Persistence = UInteractionPersistenceSubsystem::Get(this);
+
+	// A full checkpoint replaces everything recorded before it
+	if (Chunk.Type == EChunkType::Full)
+	{
+		Persistence->Reset();
+	}
+
+	// Data assets, with state index remapping for assets whose states changed since the save.
+	// LoadSlot loaded them beforehand, so they only need resolving.
+	const int32 NumAssets = Chunk.AssetPaths.Num();
+	TArray<uint16> TableAssetByChunkAsset;
+	TArray<TArray<int16>> StateRemap;
+	TableAssetByChunkAsset.SetNum(NumAssets);
+	StateRemap.SetNum(NumAssets);
+
+	for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+	{
+		const FString& Path = Chunk.AssetPaths[AssetIndex];
+		const UObject* Asset = Path.IsEmpty() ? nullptr : FSoftObjectPath(Path).ResolveObject();
+		TableAssetByChunkAsset[AssetIndex] = Persistence->FindOrAddDataAsset(Asset);
+
+		TArray<FName> CurrentStateIds;
+		InteractionSave::GetStateIds(Asset, CurrentStateIds);
+		if (!Asset || InteractionSave::GetVersionHash(CurrentStateIds) == Chunk.AssetVersionHashes[AssetIndex]) continue;
+
+		TArray<int16>& Remap = StateRemap[AssetIndex];
+		for (const FName& StateId : Chunk.AssetStateIds[AssetIndex])
+		{
+			Remap.Add(static_cast<int16>(CurrentStateIds.IndexOfByKey(StateId)));
+		}
+	}
+
+	for (int32 i = 0; i < Chunk.KeyringPlayers.Num(); ++i)
+	{
+		const uint8 PlayerIndex = Chunk.KeyringPlayers[i];
+		if (!Keyrings.IsValidIndex(PlayerIndex) || !Keyrings[PlayerIndex]) continue;
+
+		TArray<FName> OwnedKeys;
+		for (TConstSetBitIterator<> It(Chunk.KeyringBits[i]); It; ++It)
+		{
+			if (Chunk.Keys.IsValidIndex(It.GetIndex()))
+			{
+				OwnedKeys.Add(Chunk.Keys[It.GetIndex()]);
+			}
+		}
+		Keyrings[PlayerIndex]->SetOwnedKeys(OwnedKeys);
+	}
+
+	for (int32 i = 0; i < Chunk.Ids.Num(); ++i)
+	{
+		UInteractionPersistenceSubsystem::FRow Row;
+		Row.StateIndex = Chunk.StateIndices[i];
+		Row.Flags = static_cast<EInteractionPersistFlags>(Chunk.Flags[i]);
+
+		const int32 ChunkAsset = Chunk.AssetIndices[i];
+		if (TableAssetByChunkAsset.IsValidIndex(ChunkAsset))
+		{
+			const TArray<int16>& Remap = StateRemap[ChunkAsset];
+			if (Remap.Num() > 0)
+			{
+				Row.StateIndex = Remap.IsValidIndex(Row.StateIndex) ? Remap[Row.StateIndex] : static_cast<int16>(INDEX_NONE);
+			}
+			Row.AssetIndex = TableAssetByChunkAsset[ChunkAsset];
+		}
+
+		Persistence->SetRow(Chunk.Ids[i], Row);
+	}
+}
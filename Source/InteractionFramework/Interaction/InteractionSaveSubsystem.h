@@ -0,0 +1,127 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "Containers/BitArray.h"
+#include "InteractionSaveSubsystem.generated.h"
+
+class UKeyringComponent;
+struct FStreamableHandle;
+
+/**
+ * UInteractionSaveSubsystem
+ *
+ * Compact binary save/load of interactable states (the persistence table plus every live interactable)
+ * and of the local players' keyrings.
+ *
+ * A slot file is a sequence of chunks. A full checkpoint rewrites the file, a delta checkpoint appends a chunk
+ * with only the rows and keyrings changed since the previous checkpoint. Loading replays the chunks in order.
+ * Once a slot holds Interaction.Save.MaxDeltas deltas or grows past Interaction.Save.MaxSlotKB, the next
+ * checkpoint is written full, which keeps slot size and load time bounded.
+ * Rows cover the interactables themselves and their slots and instances (see UInteractionPersistenceSubsystem).
+ * Each chunk holds:
+ * - a key name table, with keyrings stored as bitsets over it
+ * - a data asset table with each asset's state ids at save time; if an asset's states changed since
+ *   (version hash differs) state indices are remapped by id on load
+ * - interactable states as packed parallel arrays (ids, asset indices, state indices, flags)
+ *
+ * The game thread only copies a chunk's contents; background tasks serialize and write them in order,
+ * so checkpoints do not hitch. Loading reads every chunk before applying any, and loads the data assets it
+ * references asynchronously.
+ */
+UCLASS()
+class INTERACTIONFRAMEWORK_API UInteractionSaveSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UInteractionSaveSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/** Writes a checkpoint. Deltas fall back to a full checkpoint when the slot has no base in this session. */
+	UFUNCTION(BlueprintCallable, Category="Interaction|Save")
+	void SaveCheckpoint(const FString& SlotName, bool bDelta = true);
+
+	/**
+	 * Replays a slot into the persistence table, the live interactables and the local keyrings.
+	 * Returns whether the slot could be read. It is applied once the data assets it references are loaded:
+	 * right away when they all are, otherwise when the async load completes.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Interaction|Save")
+	bool LoadSlot(const FString& SlotName);
+
+	UFUNCTION(BlueprintPure, Category="Interaction|Save")
+	bool IsWriting() const { return WriteTask.IsValid() && !WriteTask.IsCompleted(); }
+
+	/** Blocks until every queued write is on disk. */
+	void FlushWrites();
+
+	static FString GetSlotPath(const FString& SlotName);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	enum class EChunkType : uint8
+	{
+		Full,
+		Delta
+	};
+
+	/**
+	 * Plain contents of one chunk: copied on the game thread when saving, read from the slot when loading.
+	 * AssetVersionHashes is only filled when reading; writing hashes AssetStateIds.
+	 */
+	struct FChunkData
+	{
+		EChunkType Type = EChunkType::Full;
+		TArray<FName> Keys;
+		TArray<FString> AssetPaths;
+		TArray<uint32> AssetVersionHashes;
+		TArray<TArray<FName>> AssetStateIds;
+		TArray<uint8> KeyringPlayers;
+		TArray<TBitArray<>> KeyringBits;
+		TArray<FGuid> Ids;
+		TArray<uint16> AssetIndices;
+		TArray<int16> StateIndices;
+		TArray<uint8> Flags;
+	};
+
+	/** Last queued write; the next one runs after it. */
+	UE::Tasks::FTask WriteTask;
+
+	/** Data assets a slot being loaded is waiting for. */
+	TSharedPtr<FStreamableHandle> PendingLoad;
+
+	/** Slot the last checkpoint was written to or loaded from. Deltas are only appended to it. */
+	FString BaseSlotName;
+	bool bNeedsFullSave = true;
+
+	/** Deltas and bytes in the base slot since its last full checkpoint. */
+	int32 NumSlotDeltas = 0;
+	int64 SlotSize = 0;
+
+	/** Bumped by full checkpoints and loads, so sizes reported by writes queued before them are dropped. */
+	uint32 SlotGeneration = 0;
+
+	/** Keyring revisions at the last checkpoint, by local player index. */
+	TArray<uint32> SavedKeyringRevisions;
+
+	void GatherKeyrings(TArray<UKeyringComponent*>& OutKeyrings) const;
+	void RecordLiveInteractables() const;
+	void RestoreLiveInteractables() const;
+	void RestorePooledPickups() const;
+	void UpdateSavedKeyringRevisions(const TArray<UKeyringComponent*>& Keyrings);
+
+	void BuildChunk(EChunkType Type, const TArray<UKeyringComponent*>& Keyrings, FChunkData& OutChunk) const;
+	/** Non-const only because archives take references; the chunk is not modified. */
+	static TArray<uint8> SerializeChunk(FChunkData& Chunk);
+	void QueueWrite(const FString& Path, FChunkData&& Chunk, bool bAppend);
+
+	static bool ReadChunk(FArchive& Ar, FChunkData& OutChunk);
+	void ApplySlot(const TArray<FChunkData>& Chunks, const FString& SlotName, int64 SlotBytes);
+	void ApplyChunk(const FChunkData& Chunk, const TArray<UKeyringComponent*>& Keyrings);
+};
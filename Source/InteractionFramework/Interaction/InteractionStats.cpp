@@ -0,0 +1,46 @@
+#include "InteractionStats.h"
+
+DEFINE_STAT(STAT_InteractionFocusScan);
+DEFINE_STAT(STAT_InteractionTrace);
+DEFINE_STAT(STAT_InteractionRefreshQuery);
+DEFINE_STAT(STAT_InteractionQueryInteraction);
+DEFINE_STAT(STAT_InteractionExecutePress);
+DEFINE_STAT(STAT_InteractionDebugSnapshot);
+DEFINE_STAT(STAT_InteractionRegistryTick);
+DEFINE_STAT(STAT_InteractionSignificance);
+DEFINE_STAT(STAT_InteractionDeferredInit);
+
+DEFINE_STAT(STAT_InteractionScans);
+DEFINE_STAT(STAT_InteractionFocusChanges);
+DEFINE_STAT(STAT_InteractionQueries);
+
+DEFINE_STAT(STAT_InteractionRegisteredCount);
+DEFINE_STAT(STAT_InteractionRegisteredMemory);
+DEFINE_STAT(STAT_InteractionRegistryMemory);
+DEFINE_STAT(STAT_InteractionPersistenceMemory);
+
+DEFINE_STAT(STAT_InteractionDeferredInitCount);
+DEFINE_STAT(STAT_InteractionPendingInit);
+
+DEFINE_STAT(STAT_InteractionPickupPoolHits);
+DEFINE_STAT(STAT_InteractionPickupPoolMisses);
+DEFINE_STAT(STAT_InteractionPickupPooled);
+
+DEFINE_STAT(STAT_InteractionSignificanceEvaluations);
+DEFINE_STAT(STAT_InteractionTierNear);
+DEFINE_STAT(STAT_InteractionTierMid);
+DEFINE_STAT(STAT_InteractionTierFar);
+
+DEFINE_STAT(STAT_InteractionNetChanges);
+DEFINE_STAT(STAT_InteractionNetStateBits);
+DEFINE_STAT(STAT_InteractionNetKeyringBits);
+DEFINE_STAT(STAT_InteractionPredictions);
+DEFINE_STAT(STAT_InteractionRejections);
+
+DEFINE_STAT(STAT_InteractionSmartObjects);
+DEFINE_STAT(STAT_InteractionReservations);
+
+DEFINE_STAT(STAT_InteractionMassSelection);
+DEFINE_STAT(STAT_InteractionMassCandidates);
+DEFINE_STAT(STAT_InteractionMassRequests);
+DEFINE_STAT(STAT_InteractionMassInteracts);
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stats for the interaction framework. Use "stat Interaction" to display them in game.
+ */
+DECLARE_STATS_GROUP(TEXT("Interaction"), STATGROUP_Interaction, STATCAT_Advanced);
+
+// Cycle counters
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Focus Scan"), STAT_InteractionFocusScan, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Focus Trace"), STAT_InteractionTrace, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Refresh Query"), STAT_InteractionRefreshQuery, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("QueryInteraction"), STAT_InteractionQueryInteraction, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Execute Press"), STAT_InteractionExecutePress, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Debug Snapshot"), STAT_InteractionDebugSnapshot, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Registry Tick"), STAT_InteractionRegistryTick, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Significance"), STAT_InteractionSignificance, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Deferred Init"), STAT_InteractionDeferredInit, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+
+// Per-frame counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scans"), STAT_InteractionScans, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Focus Changes"), STAT_InteractionFocusChanges, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Queries"), STAT_InteractionQueries, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+
+// Registry
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Registered Interactables"), STAT_InteractionRegisteredCount, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Registered Interactable Memory"), STAT_InteractionRegisteredMemory, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Registry Memory"), STAT_InteractionRegistryMemory, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Persistence Memory"), STAT_InteractionPersistenceMemory, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+
+// Deferred initialization
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Inits"), STAT_InteractionDeferredInitCount, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Inits"), STAT_InteractionPendingInit, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+
+// Pickup pool
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pickup Pool Hits"), STAT_InteractionPickupPoolHits, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pickup Pool Misses"), STAT_InteractionPickupPoolMisses, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Pickups"), STAT_InteractionPickupPooled, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+
+// Significance tiers
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Significance Evaluations"), STAT_InteractionSignificanceEvaluations, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Tier Near"), STAT_InteractionTierNear, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Tier Mid"), STAT_InteractionTierMid, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Tier Far"), STAT_InteractionTierFar, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+
+// Replication (payload bits summed over connections)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Changes"), STAT_InteractionNetChanges, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net State Bits"), STAT_InteractionNetStateBits, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Keyring Bits"), STAT_InteractionNetKeyringBits, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Predicted Interacts"), STAT_InteractionPredictions, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rejected Interacts"), STAT_InteractionRejections, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+
+// AI smart objects
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Smart Objects"), STAT_InteractionSmartObjects, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI Reservations"), STAT_InteractionReservations, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+
+// Mass crowd interactors
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mass Focus Selection"), STAT_InteractionMassSelection, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mass Candidates"), STAT_InteractionMassCandidates, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mass Requests"), STAT_InteractionMassRequests, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mass Interacts"), STAT_InteractionMassInteracts, STATGROUP_Interaction, INTERACTIONFRAMEWORK_API);
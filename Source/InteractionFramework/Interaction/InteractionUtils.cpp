@@ -1,5 +1,11 @@
 ﻿#include "InteractionUtils.h"
 #include "KeyringComponent.h"
+#include "Interactable.h"
+#include "InteractableComponent.h"
+#include "InteractableInstancedComponent.h"
+#include "Interaction/Data/InteractionDataAsset.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
 
 bool InteractionUtils::BuildMissingMessages(
 	const TArray<FInteractionKeyRequirement>& Requirements,
@@ -29,3 +35,102 @@ bool InteractionUtils::BuildMissingMessages(
 
 	return OutMissingMessages.Num() > 0;
 }
+
+int32 InteractionUtils::CountMissingRequirements(
+	const TArray<FInteractionKeyRequirement>& Requirements,
+	const UKeyringComponent* Keyring)
+{
+	int32 MissingNumber = 0;
+	for (const FInteractionKeyRequirement& Req : Requirements)
+	{
+		if (!Req.KeyId.IsNone() && !(Keyring && Keyring->HasKey(Req.KeyId)))
+		{
+			++MissingNumber;
+		}
+	}
+	return MissingNumber;
+}
+
+bool InteractionUtils::GetMissingRequirementMessages(
+	const FInteractionStateDefinition& State,
+	const AActor* Interactor,
+	TArray<FText>& OutMissingMessages)
+{
+	OutMissingMessages.Reset();
+
+	if (State.RequiredKeys.Num() == 0)
+	{
+		return false;
+	}
+
+	const UKeyringComponent* Keyring =
+		Interactor ? Interactor->FindComponentByClass<UKeyringComponent>() : nullptr;
+
+	return BuildMissingMessages(State.RequiredKeys, Keyring, OutMissingMessages);
+}
+
+FInteractionQueryResult InteractionUtils::BuildQueryResult(
+	const UInteractionDataAsset* Data,
+	const FInteractionStateDefinition* State,
+	const AActor* Interactor)
+{
+	FInteractionQueryResult Result{};
+
+	// No data means no prompt
+	if (!Data || !State || !State->IsValid())
+	{
+		Result.bShouldShowPrompt = false;
+		return Result;
+	}
+
+	// Copy UI info from data asset
+	Result.bShouldShowPrompt = Data->ShouldShowPromptForState(*State);
+	Result.PromptText        = State->PromptText;
+	Result.InputType         = State->InputType;
+	Result.HoldDuration      = State->HoldDuration;
+	Result.bShouldShowRequirements = State->bShouldShowRequirements;
+
+	// Only do requirement check if there are any requirements
+	if (State->RequiredKeys.Num() > 0)
+	{
+		GetMissingRequirementMessages(*State, Interactor, Result.UnmetRequirementMessages);
+		Result.UnmetRequirementNumber = Result.UnmetRequirementMessages.Num();
+	}
+
+	return Result;
+}
+
+AActor* InteractionUtils::GetInteractableActor(const UObject* Interactable)
+{
+	if (const UActorComponent* Component = Cast<UActorComponent>(Interactable))
+	{
+		return Component->GetOwner();
+	}
+	return const_cast<AActor*>(Cast<AActor>(Interactable));
+}
+
+FVector InteractionUtils::GetInteractableLocation(const UObject* Interactable)
+{
+	if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Interactable))
+	{
+		return SceneComponent->GetComponentLocation();
+	}
+
+	const AActor* Actor = GetInteractableActor(Interactable);
+	return Actor ? Actor->GetActorLocation() : FVector::ZeroVector;
+}
+
+UObject* InteractionUtils::FindInteractable(AActor* Actor)
+{
+	if (!Actor) return nullptr;
+
+	if (Actor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	{
+		return Actor;
+	}
+	if (UInteractableComponent* Component = Actor->FindComponentByClass<UInteractableComponent>())
+	{
+		return Component;
+	}
+	return Actor->FindComponentByClass<UInteractableInstancedComponent>();
+}
@@ -4,6 +4,9 @@
 #include "Interaction/Data/InteractionTypes.h"
 
 class UKeyringComponent;
+class IInteractable;
+class UInteractionDataAsset;
+struct FInteractionStateDefinition;
 
 namespace InteractionUtils
 {
@@ -12,4 +15,32 @@ namespace InteractionUtils
 		const TArray<FInteractionKeyRequirement>& Requirements,
 		const UKeyringComponent* Keyring,
 		TArray<FText>& OutMissingMessages);
+
+	// Number of requirements the keyring does not meet.
+	int32 CountMissingRequirements(
+		const TArray<FInteractionKeyRequirement>& Requirements,
+		const UKeyringComponent* Keyring);
+
+	// Missing requirement messages of a state for the interactor's keyring. Returns true if any are missing.
+	bool GetMissingRequirementMessages(
+		const FInteractionStateDefinition& State,
+		const AActor* Interactor,
+		TArray<FText>& OutMissingMessages);
+
+	// Query result of a state of Data for the interactor. A null state (or data) hides the prompt.
+	// Shared by every interactable backed by a UInteractionDataAsset: actors, their slots, components and instances.
+	FInteractionQueryResult BuildQueryResult(
+		const UInteractionDataAsset* Data,
+		const FInteractionStateDefinition* State,
+		const AActor* Interactor);
+
+	// Actor an interactable object lives on: the object itself for actors, the owner for components.
+	AActor* GetInteractableActor(const UObject* Interactable);
+
+	// World location used for distance checks of an interactable object.
+	FVector GetInteractableLocation(const UObject* Interactable);
+
+	// Interactable object of an actor: the actor when it implements IInteractable, otherwise its UInteractableComponent
+	// or UInteractableInstancedComponent.
+	UObject* FindInteractable(AActor* Actor);
 }
@@ -1,9 +1,61 @@
 
 #include "KeyringComponent.h"
+#include "InteractionReplication.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+void FKeyringEntry::PostReplicatedAdd(const FKeyringKeyArray& InArray)
+{
+	if (UKeyringComponent* Keyring = InArray.Owner)
+	{
+		bool bAlreadyOwned = false;
+		Keyring->OwnedKeys.Add(KeyId, &bAlreadyOwned);
+		if (!bAlreadyOwned)
+		{
+			++Keyring->Revision;
+		}
+	}
+}
+
+void FKeyringEntry::PreReplicatedRemove(const FKeyringKeyArray& InArray)
+{
+	if (UKeyringComponent* Keyring = InArray.Owner)
+	{
+		if (Keyring->OwnedKeys.Remove(KeyId) > 0)
+		{
+			++Keyring->Revision;
+		}
+	}
+}
+
+bool FKeyringKeyArray::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	const int64 StartBits = DeltaParms.Writer ? DeltaParms.Writer->GetNumBits() : 0;
+	const bool bResult = FFastArraySerializer::FastArrayDeltaSerialize<FKeyringEntry, FKeyringKeyArray>(Items, DeltaParms, *this);
+
+	if (DeltaParms.Writer)
+	{
+		InteractionNet::RecordKeyringBits(DeltaParms.Writer->GetNumBits() - StartBits);
+	}
+	return bResult;
+}
 
 UKeyringComponent::UKeyringComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
+
+	SetIsReplicatedByDefault(true);
+	ReplicatedKeys.Owner = this;
+}
+
+void UKeyringComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	Params.Condition = COND_OwnerOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UKeyringComponent, ReplicatedKeys, Params);
 }
 
 bool UKeyringComponent::HasKey(FName KeyId) const
@@ -18,9 +70,16 @@ bool UKeyringComponent::AddKey(FName KeyId)
 		return false;
 	}
 
-	const int32 PrevNum = OwnedKeys.Num();
-	OwnedKeys.Add(KeyId);
-	return OwnedKeys.Num() != PrevNum;
+	bool bAlreadyOwned = false;
+	OwnedKeys.Add(KeyId, &bAlreadyOwned);
+	if (bAlreadyOwned)
+	{
+		return false;
+	}
+
+	++Revision;
+	ReplicateKeyAdded(KeyId);
+	return true;
 }
 
 bool UKeyringComponent::RemoveKey(FName KeyId)
@@ -30,7 +89,14 @@ bool UKeyringComponent::RemoveKey(FName KeyId)
 		return false;
 	}
 
-	return OwnedKeys.Remove(KeyId) > 0;
+	if (OwnedKeys.Remove(KeyId) == 0)
+	{
+		return false;
+	}
+
+	++Revision;
+	ReplicateKeyRemoved(KeyId);
+	return true;
 }
 
 bool UKeyringComponent::HasAllKeys(const TArray<FName>& RequiredKeys) const
@@ -49,4 +115,77 @@ bool UKeyringComponent::HasAllKeys(const TArray<FName>& RequiredKeys) const
 	}
 
 	return true;
+}
+
+void UKeyringComponent::SetOwnedKeys(const TArray<FName>& Keys)
+{
+	OwnedKeys.Reset();
+	for (const FName& KeyId : Keys)
+	{
+		if (!KeyId.IsNone())
+		{
+			OwnedKeys.Add(KeyId);
+		}
+	}
+
+	++Revision;
+	ReplicateAllKeys();
+}
+
+void UKeyringComponent::ReplicateKeyAdded(FName KeyId)
+{
+	if (GetOwnerRole() != ROLE_Authority) return;
+
+	FKeyringEntry& Entry = ReplicatedKeys.Items.AddDefaulted_GetRef();
+	Entry.KeyId = KeyId;
+	ReplicatedKeys.MarkItemDirty(Entry);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UKeyringComponent, ReplicatedKeys, this);
+	InteractionNet::RecordChange();
+}
+
+void UKeyringComponent::ReplicateKeyRemoved(FName KeyId)
+{
+	if (GetOwnerRole() != ROLE_Authority) return;
+
+	const int32 Index = ReplicatedKeys.Items.IndexOfByPredicate([KeyId](const FKeyringEntry& Entry)
+	{
+		return Entry.KeyId == KeyId;
+	});
+	if (Index == INDEX_NONE) return;
+
+	ReplicatedKeys.Items.RemoveAtSwap(Index);
+	ReplicatedKeys.MarkArrayDirty();
+	MARK_PROPERTY_DIRTY_FROM_NAME(UKeyringComponent, ReplicatedKeys, this);
+	InteractionNet::RecordChange();
+}
+
+void UKeyringComponent::ReplicateAllKeys()
+{
+	if (GetOwnerRole() != ROLE_Authority) return;
+
+	ReplicatedKeys.Items.Reset(OwnedKeys.Num());
+	for (const FName& KeyId : OwnedKeys)
+	{
+		ReplicatedKeys.Items.AddDefaulted_GetRef().KeyId = KeyId;
+	}
+	ReplicatedKeys.MarkArrayDirty();
+	MARK_PROPERTY_DIRTY_FROM_NAME(UKeyringComponent, ReplicatedKeys, this);
+	InteractionNet::RecordChange();
+}
+
+void UKeyringComponent::RevertToReplicatedKeys()
+{
+	if (GetOwnerRole() == ROLE_Authority) return;
+
+	TSet<FName> Replicated;
+	Replicated.Reserve(ReplicatedKeys.Items.Num());
+	for (const FKeyringEntry& Entry : ReplicatedKeys.Items)
+	{
+		Replicated.Add(Entry.KeyId);
+	}
+
+	if (Replicated.Num() == OwnedKeys.Num() && Replicated.Includes(OwnedKeys)) return;
+
+	OwnedKeys = MoveTemp(Replicated);
+	++Revision;
 }
\ No newline at end of file
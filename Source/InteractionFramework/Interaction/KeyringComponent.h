@@ -3,8 +3,54 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "KeyringComponent.generated.h"
 
+class UKeyringComponent;
+struct FKeyringKeyArray;
+
+/** One replicated key of a keyring. */
+USTRUCT()
+struct FKeyringEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName KeyId = NAME_None;
+
+	void PostReplicatedAdd(const FKeyringKeyArray& InArray);
+	void PreReplicatedRemove(const FKeyringKeyArray& InArray);
+};
+
+/**
+ * FKeyringKeyArray
+ *
+ * Replicated mirror of a keyring's keys. Delta serialized, so granting or removing a key sends that key only.
+ * Clients apply the changes to the keyring's lookup set.
+ */
+USTRUCT()
+struct FKeyringKeyArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FKeyringEntry> Items;
+
+	UPROPERTY(NotReplicated)
+	TObjectPtr<UKeyringComponent> Owner;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+};
+
+template<>
+struct TStructOpsTypeTraits<FKeyringKeyArray> : public TStructOpsTypeTraitsBase2<FKeyringKeyArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
 /**
  * UKeyringComponent
  *
@@ -15,6 +61,9 @@
  * to determine whether key-requirement interactions are available.
  *
  * Keys can be anything, a quest completion, a milestone, a collectible, actual keys, etc.
+ *
+ * Replicated to the owning client only. The server is authoritative: AddKey/RemoveKey mirror the change
+ * into ReplicatedKeys and mark it dirty (push model), and clients receive the delta.
  */
 UCLASS(ClassGroup=(Interaction), meta=(BlueprintSpawnableComponent))
 class INTERACTIONFRAMEWORK_API UKeyringComponent : public UActorComponent
@@ -24,6 +73,8 @@ class INTERACTIONFRAMEWORK_API UKeyringComponent : public UActorComponent
 public:
 	UKeyringComponent();
 
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Keyring")
 	bool HasKey(FName KeyId) const;
 
@@ -36,7 +87,31 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Keyring")
 	bool HasAllKeys(const TArray<FName>& RequiredKeys) const;
 
+	const TSet<FName>& GetOwnedKeys() const { return OwnedKeys; }
+
+	/** Replaces all owned keys, e.g. when loading a save. */
+	void SetOwnedKeys(const TArray<FName>& Keys);
+
+	/** Client prediction: drops keys added or removed locally and re-applies the keys replicated from the server. */
+	void RevertToReplicatedKeys();
+
+	/** Incremented whenever the set of owned keys changes. Lets caches keyed on availability detect changes. */
+	uint32 GetRevision() const { return Revision; }
+
 protected:
 	UPROPERTY(VisibleAnywhere, Category="Keyring")
 	TSet<FName> OwnedKeys;
+
+	UPROPERTY(Replicated)
+	FKeyringKeyArray ReplicatedKeys;
+
+	uint32 Revision = 0;
+
+private:
+	friend struct FKeyringEntry;
+
+	/** Authority only: mirrors OwnedKeys into ReplicatedKeys. */
+	void ReplicateKeyAdded(FName KeyId);
+	void ReplicateKeyRemoved(FName KeyId);
+	void ReplicateAllKeys();
 };
@@ -0,0 +1,78 @@
+#include "InteractionMassProcessor.h"
+#include "InteractionMassSubsystem.h"
+#include "Interaction/InteractionStats.h"
+#include "MassExecutionContext.h"
+
+UInteractionMassProcessor::UInteractionMassProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Standalone | EProcessorExecutionFlags::Server);
+
+	// After movement, so agents focus from where they ended the frame.
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+	bRequiresGameThreadExecution = false;
+}
+
+void UInteractionMassProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FInteractionViewFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FInteractionKeysFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FInteractionFocusFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddSubsystemRequirement<UInteractionMassSubsystem>(EMassFragmentAccess::ReadWrite);
+}
+
+void UInteractionMassProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionMassSelection);
+
+	UInteractionMassSubsystem& Interaction = Context.GetMutableSubsystemChecked<UInteractionMassSubsystem>();
+	const FInteractionMassCandidates& Candidates = Interaction.GetCandidates();
+	const float DeltaSeconds = Context.GetDeltaTimeSeconds();
+
+	EntityQuery.ParallelForEachEntityChunk(Context, [&Interaction, &Candidates, DeltaSeconds](FMassExecutionContext& ChunkContext)
+	{
+		const TConstArrayView<FInteractionViewFragment> Views = ChunkContext.GetFragmentView<FInteractionViewFragment>();
+		const TConstArrayView<FInteractionKeysFragment> Keys = ChunkContext.GetFragmentView<FInteractionKeysFragment>();
+		const TArrayView<FInteractionFocusFragment> Focuses = ChunkContext.GetMutableFragmentView<FInteractionFocusFragment>();
+
+		TArray<FInteractionMassRequest, TInlineAllocator<16>> Requests;
+
+		for (int32 Index = 0; Index < ChunkContext.GetNumEntities(); ++Index)
+		{
+			FInteractionFocusFragment& Focus = Focuses[Index];
+
+			const int32 Best = Candidates.FindBest(Views[Index]);
+			const FObjectKey Target = Best != INDEX_NONE ? Candidates.Objects[Best] : FObjectKey();
+			if (Target != Focus.Target)
+			{
+				Focus.Target = Target;
+				Focus.HoldElapsed = 0.f;
+			}
+
+			Focus.bRequirementsMet = Best != INDEX_NONE && Keys[Index].Keys.ContainsAll(Candidates.RequiredKeys[Best]);
+
+			if (!Focus.bWantsToInteract || Best == INDEX_NONE)
+			{
+				Focus.HoldElapsed = 0.f;
+				continue;
+			}
+
+			// Like a player press on an unavailable interactable, the attempt is spent.
+			if (!Focus.bRequirementsMet)
+			{
+				Focus.bWantsToInteract = false;
+				Focus.HoldElapsed = 0.f;
+				continue;
+			}
+
+			Focus.HoldElapsed += DeltaSeconds;
+			if (Focus.HoldElapsed < Candidates.HoldDurations[Best]) continue;
+
+			Requests.Add({ ChunkContext.GetEntity(Index), Target });
+			Focus.bWantsToInteract = false;
+			Focus.HoldElapsed = 0.f;
+		}
+
+		Interaction.QueueRequests(Requests);
+	});
+}
@@ -0,0 +1,31 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "InteractionMassProcessor.generated.h"
+
+/**
+ * UInteractionMassProcessor
+ *
+ * Focus selection for crowd interactors, run off the game thread in parallel chunks. For each agent it picks
+ * the candidate closest to its view direction from UInteractionMassSubsystem's grid, checks the focused state's
+ * requirements against the agent's key bits and, when the agent wants to interact, advances holds and queues
+ * the interact back to the game thread. Nothing here touches UObjects.
+ */
+UCLASS()
+class INTERACTIONFRAMEWORK_API UInteractionMassProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UInteractionMassProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
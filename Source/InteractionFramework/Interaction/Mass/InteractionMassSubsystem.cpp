@@ -0,0 +1,392 @@
+#include "InteractionMassSubsystem.h"
+#include "Interaction/Interactable.h"
+#include "Interaction/InteractionRegistrySubsystem.h"
+#include "Interaction/InteractionStats.h"
+#include "Interaction/InteractionUtils.h"
+#include "Interaction/KeyringComponent.h"
+#include "Interaction/Data/InteractionDataAsset.h"
+#include "MassEntitySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<float> CVarMassCellSize(
+	TEXT("Interaction.Mass.CellSize"),
+	500.f,
+	TEXT("Cell size (cm) of the candidate grid crowd interactors search. About the typical crowd view range works best."));
+
+UInteractionMassSubsystem* UInteractionMassSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInteractionMassSubsystem>() : nullptr;
+}
+
+bool UInteractionMassSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UInteractionMassSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionMassSubsystem, STATGROUP_Tickables);
+}
+
+void UInteractionMassSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	Collection.InitializeDependency<UInteractionRegistrySubsystem>();
+
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		RegisteredHandle = Registry->OnInteractableRegistered.AddUObject(this, &UInteractionMassSubsystem::HandleInteractableRegistered);
+		UnregisteredHandle = Registry->OnInteractableUnregistered.AddUObject(this, &UInteractionMassSubsystem::HandleInteractableUnregistered);
+		StateChangedHandle = Registry->OnInteractableStateChanged.AddUObject(this, &UInteractionMassSubsystem::HandleInteractableStateChanged);
+	}
+}
+
+void UInteractionMassSubsystem::Deinitialize()
+{
+	if (UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		Registry->OnInteractableRegistered.Remove(RegisteredHandle);
+		Registry->OnInteractableUnregistered.Remove(UnregisteredHandle);
+		Registry->OnInteractableStateChanged.Remove(StateChangedHandle);
+	}
+
+	Candidates.Reset();
+	CandidateChanges.Reset();
+	CandidateIndexByObject.Reset();
+	PendingRequests.Reset();
+	ProcessingRequests.Reset();
+	CrowdInteractor = nullptr;
+	CrowdKeyring = nullptr;
+	bKeysLoaded = false;
+
+	Super::Deinitialize();
+}
+
+void UInteractionMassSubsystem::Tick(float DeltaTime)
+{
+	ProcessRequests();
+	UpdateCandidates();
+}
+
+int32 UInteractionMassSubsystem::FindOrAddKeyBit(FName KeyId)
+{
+	if (const int32* Bit = KeyBits.Find(KeyId))
+	{
+		return *Bit;
+	}
+
+	if (KeyIdsByBit.Num() >= FInteractionKeyBits::MaxKeys)
+	{
+		if (!bWarnedKeyOverflow)
+		{
+			bWarnedKeyOverflow = true;
+			UE_LOG(LogInteractionFramework, Warning, TEXT("More than %d distinct keys used by crowd interactors; %s and later keys are ignored."),
+				FInteractionKeyBits::MaxKeys, *KeyId.ToString());
+		}
+		return INDEX_NONE;
+	}
+
+	const int32 Bit = KeyIdsByBit.Add(KeyId);
+	KeyBits.Add(KeyId, Bit);
+	return Bit;
+}
+
+FInteractionKeyBits UInteractionMassSubsystem::MakeKeyBits(const TArray<FName>& KeyIds)
+{
+	FInteractionKeyBits Keys;
+	for (const FName KeyId : KeyIds)
+	{
+		const int32 Bit = FindOrAddKeyBit(KeyId);
+		if (Bit != INDEX_NONE)
+		{
+			Keys.Add(Bit);
+		}
+	}
+	return Keys;
+}
+
+FInteractionKeyBits UInteractionMassSubsystem::MakeKeyBits(const TSet<FName>& KeyIds)
+{
+	FInteractionKeyBits Keys;
+	for (const FName KeyId : KeyIds)
+	{
+		const int32 Bit = FindOrAddKeyBit(KeyId);
+		if (Bit != INDEX_NONE)
+		{
+			Keys.Add(Bit);
+		}
+	}
+	return Keys;
+}
+
+void UInteractionMassSubsystem::GetKeyIds(const FInteractionKeyBits& Keys, TArray<FName>& OutKeyIds) const
+{
+	OutKeyIds.Reset();
+	for (int32 Bit = 0; Bit < KeyIdsByBit.Num(); ++Bit)
+	{
+		if (Keys.Contains(Bit))
+		{
+			OutKeyIds.Add(KeyIdsByBit[Bit]);
+		}
+	}
+}
+
+void UInteractionMassSubsystem::QueueRequests(TConstArrayView<FInteractionMassRequest> Requests)
+{
+	if (Requests.IsEmpty()) return;
+
+	FScopeLock Lock(&RequestLock);
+	PendingRequests.Append(Requests.GetData(), Requests.Num());
+}
+
+UKeyringComponent* UInteractionMassSubsystem::GetCrowdKeyring()
+{
+	if (CrowdKeyring) return CrowdKeyring;
+
+	FActorSpawnParameters Params;
+	Params.ObjectFlags |= RF_Transient;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	CrowdInteractor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+	if (!CrowdInteractor) return nullptr;
+
+	CrowdKeyring = NewObject<UKeyringComponent>(CrowdInteractor, TEXT("CrowdKeyring"));
+	CrowdKeyring->RegisterComponent();
+	return CrowdKeyring;
+}
+
+void UInteractionMassSubsystem::ProcessRequests()
+{
+	{
+		FScopeLock Lock(&RequestLock);
+		if (PendingRequests.IsEmpty()) return;
+		Swap(PendingRequests, ProcessingRequests);
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_InteractionMassRequests);
+
+	UMassEntitySubsystem* EntitySubsystem = GetWorld()->GetSubsystem<UMassEntitySubsystem>();
+	UKeyringComponent* Keyring = GetCrowdKeyring();
+	if (!EntitySubsystem || !Keyring)
+	{
+		ProcessingRequests.Reset();
+		return;
+	}
+
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+
+	// Agents with the same keys run back to back, so the proxy keyring is rewritten (which bumps its revision)
+	// once per distinct key set instead of once per request.
+	RequestOrder.Reset();
+	for (int32 Index = 0; Index < ProcessingRequests.Num(); ++Index)
+	{
+		const FMassEntityHandle Entity = ProcessingRequests[Index].Entity;
+		const FInteractionKeysFragment* Keys = EntityManager.IsEntityValid(Entity) ? EntityManager.GetFragmentDataPtr<FInteractionKeysFragment>(Entity) : nullptr;
+		if (Keys)
+		{
+			RequestOrder.Add({ Keys->Keys, Index });
+		}
+	}
+	RequestOrder.Sort([](const FOrderedRequest& A, const FOrderedRequest& B) { return A.Keys < B.Keys; });
+
+	for (const FOrderedRequest& Ordered : RequestOrder)
+	{
+		const FInteractionMassRequest& Request = ProcessingRequests[Ordered.Index];
+		UObject* Target = Request.Target.ResolveObjectPtr();
+		if (!Target || !Target->Implements<UInteractable>() || !EntityManager.IsEntityValid(Request.Entity)) continue;
+
+		FInteractionKeysFragment* Keys = EntityManager.GetFragmentDataPtr<FInteractionKeysFragment>(Request.Entity);
+		if (!Keys) continue;
+
+		if (!bKeysLoaded || Keyring->GetRevision() != LoadedKeysRevision || !(Keys->Keys == LoadedKeys))
+		{
+			GetKeyIds(Keys->Keys, KeyIdScratch);
+			Keyring->SetOwnedKeys(KeyIdScratch);
+			LoadedKeys = Keys->Keys;
+			LoadedKeysRevision = Keyring->GetRevision();
+			bKeysLoaded = true;
+		}
+
+		IInteractable::Execute_Interact(Target, CrowdInteractor);
+
+		// Interactables grant or take keys through the interactor's keyring.
+		if (Keyring->GetRevision() != LoadedKeysRevision)
+		{
+			Keys->Keys = MakeKeyBits(Keyring->GetOwnedKeys());
+		}
+
+		++NumInteracts;
+		INC_DWORD_STAT(STAT_InteractionMassInteracts);
+	}
+
+	ProcessingRequests.Reset();
+}
+
+void UInteractionMassSubsystem::HandleInteractableRegistered(UObject* Interactable)
+{
+	CandidateChanges.Add({ FObjectKey(Interactable), Interactable, ECandidateChange::Added });
+}
+
+void UInteractionMassSubsystem::HandleInteractableUnregistered(UObject* Interactable)
+{
+	CandidateChanges.Add({ FObjectKey(Interactable), nullptr, ECandidateChange::Removed });
+}
+
+void UInteractionMassSubsystem::HandleInteractableStateChanged(UObject* Interactable)
+{
+	CandidateChanges.Add({ FObjectKey(Interactable), Interactable, ECandidateChange::StateChanged });
+}
+
+void UInteractionMassSubsystem::UpdateCandidates()
+{
+	if (bNeedsFullRebuild)
+	{
+		RebuildCandidates();
+		return;
+	}
+
+	const float CellSize = CVarMassCellSize.GetValueOnGameThread();
+	if (CandidateChanges.IsEmpty() && FMath::Max(CellSize, 1.f) == Candidates.CellSize) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_InteractionMassCandidates);
+
+	// Applied in order, so an interactable unregistered and registered again (e.g. a pooled pickup) ends up added.
+	bool bCellsDirty = FMath::Max(CellSize, 1.f) != Candidates.CellSize;
+	for (const FCandidateChange& Change : CandidateChanges)
+	{
+		switch (Change.Change)
+		{
+		case ECandidateChange::Added:
+			if (UObject* Object = Change.Object.Get())
+			{
+				AddCandidate(Object);
+				bCellsDirty = true;
+			}
+			break;
+
+		case ECandidateChange::StateChanged:
+		{
+			const int32* Index = CandidateIndexByObject.Find(Change.Key);
+			const UObject* Object = Change.Object.Get();
+			if (Index && Object)
+			{
+				EvaluateCandidate(*Index, Object);
+			}
+			break;
+		}
+
+		case ECandidateChange::Removed:
+			if (CandidateIndexByObject.Contains(Change.Key))
+			{
+				RemoveCandidate(Change.Key);
+				bCellsDirty = true;
+			}
+			break;
+		}
+	}
+	CandidateChanges.Reset();
+
+	if (bCellsDirty)
+	{
+		Candidates.BuildCells(CellSize);
+	}
+}
+
+void UInteractionMassSubsystem::RebuildCandidates()
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionMassCandidates);
+
+	Candidates.Reset();
+	CandidateIndexByObject.Reset();
+	CandidateChanges.Reset();
+	bNeedsFullRebuild = false;
+
+	if (const UInteractionRegistrySubsystem* Registry = UInteractionRegistrySubsystem::Get(this))
+	{
+		for (const TWeakObjectPtr<UObject>& Entry : Registry->GetRegisteredInteractables())
+		{
+			if (UObject* Object = Entry.Get())
+			{
+				AddCandidate(Object);
+			}
+		}
+	}
+
+	Candidates.BuildCells(CVarMassCellSize.GetValueOnGameThread());
+}
+
+void UInteractionMassSubsystem::AddCandidate(UObject* Interactable)
+{
+	const IInteractable* AsInteractable = Cast<IInteractable>(Interactable);
+	if (!AsInteractable || AsInteractable->HasInteractionItems()) return;
+
+	const FObjectKey Key(Interactable);
+	const FVector Location = InteractionUtils::GetInteractableLocation(Interactable);
+
+	int32 Index = INDEX_NONE;
+	if (const int32* Existing = CandidateIndexByObject.Find(Key))
+	{
+		Index = *Existing;
+		Candidates.Locations[Index] = Location;
+	}
+	else
+	{
+		Index = Candidates.Add(Location, Key);
+		CandidateIndexByObject.Add(Key, Index);
+	}
+
+	EvaluateCandidate(Index, Interactable);
+}
+
+void UInteractionMassSubsystem::RemoveCandidate(FObjectKey Key)
+{
+	int32 Index = INDEX_NONE;
+	if (!CandidateIndexByObject.RemoveAndCopyValue(Key, Index)) return;
+
+	Candidates.RemoveAtSwap(Index);
+	if (Candidates.Objects.IsValidIndex(Index))
+	{
+		CandidateIndexByObject[Candidates.Objects[Index]] = Index;
+	}
+}
+
+void UInteractionMassSubsystem::EvaluateCandidate(int32 Index, const UObject* Interactable)
+{
+	FInteractionKeyBits Required;
+	float HoldDuration = 0.f;
+	bool bAvailable = false;
+
+	const IInteractable* AsInteractable = Cast<IInteractable>(Interactable);
+	if (AsInteractable && AsInteractable->IsInteractionInitialized() && AsInteractable->IsAvailableToAI())
+	{
+		bAvailable = true;
+
+		// Requirements gate interaction data states only; NPC requirements pick a dialogue line instead.
+		const UInteractionDataAsset* Data = Cast<UInteractionDataAsset>(AsInteractable->GetPersistentDataAsset());
+		if (const FInteractionStateDefinition* State = Data ? Data->FindStateById(AsInteractable->GetInteractionStateId()) : nullptr)
+		{
+			for (const FInteractionKeyRequirement& Requirement : State->RequiredKeys)
+			{
+				if (Requirement.KeyId.IsNone()) continue;
+
+				// A requirement without a bit can never be met by a crowd agent.
+				const int32 Bit = FindOrAddKeyBit(Requirement.KeyId);
+				bAvailable &= Bit != INDEX_NONE;
+				if (Bit != INDEX_NONE)
+				{
+					Required.Add(Bit);
+				}
+			}
+
+			HoldDuration = UInteractionDataAsset::IsHoldInteraction(*State) ? State->HoldDuration : 0.f;
+		}
+	}
+
+	Candidates.RequiredKeys[Index] = Required;
+	Candidates.HoldDurations[Index] = HoldDuration;
+	Candidates.Available[Index] = bAvailable;
+}
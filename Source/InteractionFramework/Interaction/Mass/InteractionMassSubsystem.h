@@ -0,0 +1,155 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassExternalSubsystemTraits.h"
+#include "Interaction/Mass/InteractionMassTypes.h"
+#include "InteractionMassSubsystem.generated.h"
+
+class UKeyringComponent;
+
+/**
+ * UInteractionMassSubsystem
+ *
+ * Game-thread side of the Mass Entity integration, for crowds too large for a UInteractionComponent and a
+ * UKeyringComponent per actor. Agents are entities with FInteractionViewFragment, FInteractionKeysFragment and
+ * FInteractionFocusFragment; UInteractionMassProcessor selects their focus in parallel chunks.
+ *
+ * Every tick the subsystem
+ * - runs the interacts queued by the processor. Each one goes through IInteractable::Interact with a shared
+ *   proxy interactor whose keyring is loaded from the agent's key bits, and keys the interactable grants or
+ *   takes are written back to the agent. Requests are grouped by key set, so the proxy keyring is only
+ *   rewritten once per distinct set.
+ * - applies the registry's registration and state change notifications since the last tick to the candidate
+ *   grid the processor reads on the next frame: registered interactables without items, with their requirements
+ *   as key bits, focusable while initialized and available to AI. Nothing is rebuilt on ticks without changes.
+ *
+ * Candidate locations are read when an interactable registers; moving interactables are not tracked.
+ * Crowd focus is a view cone test without visibility traces and ignores significance tiers.
+ */
+UCLASS()
+class INTERACTIONFRAMEWORK_API UInteractionMassSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UInteractionMassSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Bit assigned to a key id, assigning the next free one. INDEX_NONE once all MaxKeys bits are used. */
+	int32 FindOrAddKeyBit(FName KeyId);
+
+	FInteractionKeyBits MakeKeyBits(const TArray<FName>& KeyIds);
+	FInteractionKeyBits MakeKeyBits(const TSet<FName>& KeyIds);
+	void GetKeyIds(const FInteractionKeyBits& Keys, TArray<FName>& OutKeyIds) const;
+
+	/** Candidates of the current frame. Read by the processor, only changed on the game thread. */
+	const FInteractionMassCandidates& GetCandidates() const { return Candidates; }
+
+	/** Thread safe; called by the processor once per chunk. */
+	void QueueRequests(TConstArrayView<FInteractionMassRequest> Requests);
+
+	/** Runs the queued interacts. Called from Tick; exposed for benchmarks. */
+	void ProcessRequests();
+
+	/** Applies the queued registry notifications to the candidates. Called from Tick; exposed for benchmarks. */
+	void UpdateCandidates();
+
+	/** Rebuilds the candidates from the whole registry. Done by the first update; exposed for benchmarks. */
+	void RebuildCandidates();
+
+	/** Interacts run since the subsystem was created. */
+	int64 GetNumInteracts() const { return NumInteracts; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Proxy passed as the interactor of crowd interacts, so interactables find a keyring as usual. */
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> CrowdInteractor;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UKeyringComponent> CrowdKeyring;
+
+	FInteractionMassCandidates Candidates;
+
+	enum class ECandidateChange : uint8
+	{
+		Added,
+		StateChanged,
+		Removed,
+	};
+
+	/** Registry notification queued for the next update; candidates only change in Tick. */
+	struct FCandidateChange
+	{
+		FObjectKey Key;
+		TWeakObjectPtr<UObject> Object;
+		ECandidateChange Change;
+	};
+
+	TArray<FCandidateChange> CandidateChanges;
+	TMap<FObjectKey, int32> CandidateIndexByObject;
+	bool bNeedsFullRebuild = true;
+
+	FDelegateHandle RegisteredHandle;
+	FDelegateHandle UnregisteredHandle;
+	FDelegateHandle StateChangedHandle;
+
+	TMap<FName, int32> KeyBits;
+	TArray<FName> KeyIdsByBit;
+	bool bWarnedKeyOverflow = false;
+
+	FCriticalSection RequestLock;
+	TArray<FInteractionMassRequest> PendingRequests;
+
+	/** Swapped with PendingRequests while processing so both keep their capacity. */
+	TArray<FInteractionMassRequest> ProcessingRequests;
+	TArray<FName> KeyIdScratch;
+
+	/** Processing order of ProcessingRequests, grouped by the agents' keys. */
+	struct FOrderedRequest
+	{
+		FInteractionKeyBits Keys;
+		int32 Index;
+	};
+	TArray<FOrderedRequest> RequestOrder;
+
+	/** Key bits loaded on the crowd keyring, valid while its revision is still LoadedKeysRevision. */
+	FInteractionKeyBits LoadedKeys;
+	uint32 LoadedKeysRevision = 0;
+	bool bKeysLoaded = false;
+
+	int64 NumInteracts = 0;
+
+	UKeyringComponent* GetCrowdKeyring();
+
+	void HandleInteractableRegistered(UObject* Interactable);
+	void HandleInteractableUnregistered(UObject* Interactable);
+	void HandleInteractableStateChanged(UObject* Interactable);
+
+	/** Adds Interactable's entry, or moves an existing one to its current location. */
+	void AddCandidate(UObject* Interactable);
+	void RemoveCandidate(FObjectKey Key);
+
+	/** Rewrites the requirements, hold duration and availability of a candidate from Interactable's state. */
+	void EvaluateCandidate(int32 Index, const UObject* Interactable);
+};
+
+template<>
+struct TMassExternalSubsystemTraits<UInteractionMassSubsystem> final
+{
+	enum
+	{
+		GameThreadOnly = false,
+		ThreadSafeWrite = true,
+	};
+};
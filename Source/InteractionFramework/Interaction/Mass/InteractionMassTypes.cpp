@@ -0,0 +1,102 @@
+#include "InteractionMassTypes.h"
+
+void FInteractionMassCandidates::Reset()
+{
+	Locations.Reset();
+	RequiredKeys.Reset();
+	HoldDurations.Reset();
+	Objects.Reset();
+	Available.Reset();
+	CellEntries.Reset();
+	Cells.Reset();
+}
+
+int32 FInteractionMassCandidates::Add(const FVector& Location, FObjectKey Object)
+{
+	Locations.Add(Location);
+	RequiredKeys.AddDefaulted();
+	HoldDurations.Add(0.f);
+	Available.Add(false);
+	return Objects.Add(Object);
+}
+
+void FInteractionMassCandidates::RemoveAtSwap(int32 Index)
+{
+	Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RequiredKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HoldDurations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Objects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Available.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void FInteractionMassCandidates::BuildCells(float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.f);
+	Cells.Reset();
+
+	auto CellOf = [this](const FVector& Location)
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+	};
+
+	CellEntries.SetNumUninitialized(Num());
+	for (int32 Index = 0; Index < Num(); ++Index)
+	{
+		CellEntries[Index] = Index;
+	}
+
+	CellEntries.Sort([this, &CellOf](int32 A, int32 B)
+	{
+		const FIntPoint CellA = CellOf(Locations[A]);
+		const FIntPoint CellB = CellOf(Locations[B]);
+		return CellA.X != CellB.X ? CellA.X < CellB.X : CellA.Y < CellB.Y;
+	});
+
+	for (int32 Entry = 0; Entry < CellEntries.Num(); ++Entry)
+	{
+		TPair<int32, int32>& Range = Cells.FindOrAdd(CellOf(Locations[CellEntries[Entry]]), TPair<int32, int32>(Entry, 0));
+		++Range.Value;
+	}
+}
+
+int32 FInteractionMassCandidates::FindBest(const FInteractionViewFragment& View) const
+{
+	if (Cells.IsEmpty()) return INDEX_NONE;
+
+	const double RangeSq = FMath::Square(static_cast<double>(View.Range));
+	const int32 MinX = FMath::FloorToInt32((View.Location.X - View.Range) / CellSize);
+	const int32 MaxX = FMath::FloorToInt32((View.Location.X + View.Range) / CellSize);
+	const int32 MinY = FMath::FloorToInt32((View.Location.Y - View.Range) / CellSize);
+	const int32 MaxY = FMath::FloorToInt32((View.Location.Y + View.Range) / CellSize);
+
+	int32 Best = INDEX_NONE;
+	float BestCosine = View.MinViewCosine;
+
+	for (int32 X = MinX; X <= MaxX; ++X)
+	{
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			const TPair<int32, int32>* Range = Cells.Find(FIntPoint(X, Y));
+			if (!Range) continue;
+
+			for (int32 Entry = Range->Key; Entry < Range->Key + Range->Value; ++Entry)
+			{
+				const int32 Index = CellEntries[Entry];
+				if (!Available[Index]) continue;
+
+				const FVector Delta = Locations[Index] - View.Location;
+				const double DistSq = Delta.SizeSquared();
+				if (DistSq > RangeSq || DistSq < UE_KINDA_SMALL_NUMBER) continue;
+
+				const float Cosine = FVector3f(Delta).Dot(View.Forward) * FMath::InvSqrt(static_cast<float>(DistSq));
+				if (Cosine > BestCosine)
+				{
+					BestCosine = Cosine;
+					Best = Index;
+				}
+			}
+		}
+	}
+
+	return Best;
+}
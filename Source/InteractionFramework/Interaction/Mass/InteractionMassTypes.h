@@ -0,0 +1,142 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionMassTypes.generated.h"
+
+/**
+ * Fixed-size key set for crowd interactors. Bits are assigned to key ids by UInteractionMassSubsystem,
+ * so a keyring is a few words instead of a hash set per agent.
+ */
+struct FInteractionKeyBits
+{
+	static constexpr int32 NumWords = 4;
+	static constexpr int32 MaxKeys = NumWords * 64;
+
+	uint64 Words[NumWords] = {};
+
+	void Add(int32 Bit) { Words[Bit >> 6] |= 1ull << (Bit & 63); }
+	void Remove(int32 Bit) { Words[Bit >> 6] &= ~(1ull << (Bit & 63)); }
+	bool Contains(int32 Bit) const { return (Words[Bit >> 6] & (1ull << (Bit & 63))) != 0; }
+
+	bool ContainsAll(const FInteractionKeyBits& Required) const
+	{
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			if ((Words[Word] & Required.Words[Word]) != Required.Words[Word]) return false;
+		}
+		return true;
+	}
+
+	bool operator==(const FInteractionKeyBits& Other) const
+	{
+		return FMemory::Memcmp(Words, Other.Words, sizeof(Words)) == 0;
+	}
+
+	/** Arbitrary strict order, for grouping equal key sets. */
+	bool operator<(const FInteractionKeyBits& Other) const
+	{
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			if (Words[Word] != Other.Words[Word]) return Words[Word] < Other.Words[Word];
+		}
+		return false;
+	}
+};
+
+/** Where a crowd interactor looks from. Written by movement/animation processors, read by the interaction processor. */
+USTRUCT()
+struct FInteractionViewFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FVector Location = FVector::ZeroVector;
+
+	/** Normalized view direction. */
+	FVector3f Forward = FVector3f::ForwardVector;
+
+	/** Counterpart of UInteractionComponent::TraceDistance. */
+	float Range = 500.f;
+
+	/** Cosine of the view cone half angle; the candidate closest to the view direction inside it is focused. */
+	float MinViewCosine = 0.9f;
+};
+
+/** Keys owned by a crowd interactor, see UInteractionMassSubsystem::MakeKeyBits. */
+USTRUCT()
+struct FInteractionKeysFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FInteractionKeyBits Keys;
+};
+
+/** Focus and interaction intent of a crowd interactor. */
+USTRUCT()
+struct FInteractionFocusFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** Focused interactable, none when nothing is in view. */
+	FObjectKey Target;
+
+	/** Time the interact has been held on Target, for hold states. */
+	float HoldElapsed = 0.f;
+
+	/** The agent's keys meet the focused state's requirements. */
+	bool bRequirementsMet = false;
+
+	/**
+	 * Set by gameplay logic to interact with the focused target. Consumed by the interaction processor once
+	 * the interact is queued (after the hold duration for hold states) or when the requirements are not met.
+	 */
+	bool bWantsToInteract = false;
+};
+
+/** Interact queued by the interaction processor, run on the game thread by UInteractionMassSubsystem. */
+struct FInteractionMassRequest
+{
+	FMassEntityHandle Entity;
+	FObjectKey Target;
+};
+
+/**
+ * Read-only view of the registered interactables for the interaction processor, updated on the game thread.
+ * Candidates are bucketed in a 2D grid so each agent only tests the cells its view range overlaps.
+ * State changes only rewrite an entry in place; the cells are rebuilt when entries are added or removed.
+ */
+struct FInteractionMassCandidates
+{
+	float CellSize = 500.f;
+
+	// Parallel arrays, one entry per registered interactable without items.
+	TArray<FVector> Locations;
+	TArray<FInteractionKeyBits> RequiredKeys;
+	TArray<float> HoldDurations;
+	TArray<FObjectKey> Objects;
+
+	/** Initialized, available to AI and with requirements crowd agents can meet. Others are never focused. */
+	TArray<bool> Available;
+
+	/** Candidate indices sorted by cell. Cells maps a cell to its first entry and count in CellEntries. */
+	TArray<int32> CellEntries;
+	TMap<FIntPoint, TPair<int32, int32>> Cells;
+
+	int32 Num() const { return Objects.Num(); }
+
+	void Reset();
+
+	/** Appends an entry to the parallel arrays and returns its index. Cells have to be rebuilt afterwards. */
+	int32 Add(const FVector& Location, FObjectKey Object);
+
+	/** Moves the last entry into Index. Cells have to be rebuilt afterwards. */
+	void RemoveAtSwap(int32 Index);
+
+	/** Sorts the candidates into cells. Called after the parallel arrays were filled. */
+	void BuildCells(float InCellSize);
+
+	/** Candidate closest to the view direction within range and view cone, INDEX_NONE when there is none. */
+	int32 FindBest(const FInteractionViewFragment& View) const;
+};
@@ -12,16 +12,23 @@ public class InteractionFramework : ModuleRules
 			"Core",
 			"CoreUObject",
 			"Engine",
+			"NetCore",
 			"InputCore",
 			"EnhancedInput",
 			"AIModule",
 			"StateTreeModule",
 			"GameplayStateTreeModule",
+			"SmartObjectsModule",
+			"GameplayTags",
+			"MassEntity",
 			"UMG",
 			"Slate"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"TraceLog",
+			"Json"
+		});
 
 		PublicIncludePaths.AddRange(new string[] {
 			"InteractionFramework",
@@ -76,8 +76,7 @@ void AInteractionFrameworkPlayerController::CreatePromptWidgetIfNeeded()
 
 	PromptWidget->AddToViewport();
 	
-	PromptWidget->BP_SetPromptVisible(false);
-	PromptWidget->BP_SetHoldProgress(0.f);
+	ResetPresentedPrompt();
 }
 
 void AInteractionFrameworkPlayerController::BindToInteractionComponent(UInteractionComponent* InteractionComp)
@@ -90,11 +89,8 @@ void AInteractionFrameworkPlayerController::BindToInteractionComponent(UInteract
 		return;
 	}
 
-	CachedInteractionComponent->OnFocusChanged.AddDynamic(this, &AInteractionFrameworkPlayerController::HandleFocusChanged);
-	CachedInteractionComponent->OnQueryUpdated.AddDynamic(this, &AInteractionFrameworkPlayerController::HandleQueryUpdated);
-	CachedInteractionComponent->OnHoldProgress.AddDynamic(this, &AInteractionFrameworkPlayerController::HandleHoldProgress);
-	CachedInteractionComponent->OnHoldReset.AddDynamic(this, &AInteractionFrameworkPlayerController::HandleHoldReset);
-	CachedInteractionComponent->OnHoldCompleted.AddDynamic(this, &AInteractionFrameworkPlayerController::HandleHoldCompleted);
+	// The prompt only needs the final state of each frame.
+	CachedInteractionComponent->OnFrameDeltaNative.AddUObject(this, &AInteractionFrameworkPlayerController::HandleFrameDelta);
 
 	// Initialize UI with current state.
 	HandleQueryUpdated(CachedInteractionComponent->GetCachedQueryResult());
@@ -104,19 +100,64 @@ void AInteractionFrameworkPlayerController::UnbindFromInteractionComponent()
 {
 	if (!CachedInteractionComponent) return;
 
-	CachedInteractionComponent->OnFocusChanged.RemoveDynamic(this, &AInteractionFrameworkPlayerController::HandleFocusChanged);
-	CachedInteractionComponent->OnQueryUpdated.RemoveDynamic(this, &AInteractionFrameworkPlayerController::HandleQueryUpdated);
-	CachedInteractionComponent->OnHoldProgress.RemoveDynamic(this, &AInteractionFrameworkPlayerController::HandleHoldProgress);
-	CachedInteractionComponent->OnHoldReset.RemoveDynamic(this, &AInteractionFrameworkPlayerController::HandleHoldReset);
-	CachedInteractionComponent->OnHoldCompleted.RemoveDynamic(this, &AInteractionFrameworkPlayerController::HandleHoldCompleted);
+	CachedInteractionComponent->OnFrameDeltaNative.RemoveAll(this);
 
 	CachedInteractionComponent = nullptr;
 
 	// Hide prompt when unpossessed
-	if (PromptWidget)
+	ResetPresentedPrompt();
+}
+
+void AInteractionFrameworkPlayerController::SetPromptVisible(bool bVisible)
+{
+	if (!PromptWidget || bPresentedPromptVisible == bVisible) return;
+
+	bPresentedPromptVisible = bVisible;
+	PromptWidget->BP_SetPromptVisible(bVisible);
+}
+
+void AInteractionFrameworkPlayerController::SetHoldProgress(float Progress)
+{
+	if (!PromptWidget || PresentedHoldProgress == Progress) return;
+
+	PresentedHoldProgress = Progress;
+	PromptWidget->BP_SetHoldProgress(Progress);
+}
+
+void AInteractionFrameworkPlayerController::ResetPresentedPrompt()
+{
+	bHasPresentedQuery = false;
+	PresentedQuery = FInteractionQueryResult{};
+
+	if (!PromptWidget) return;
+
+	// Force a push so the widget matches the cached state.
+	bPresentedPromptVisible = false;
+	PresentedHoldProgress = 0.f;
+	PromptWidget->BP_SetPromptVisible(false);
+	PromptWidget->BP_SetHoldProgress(0.f);
+}
+
+void AInteractionFrameworkPlayerController::HandleFrameDelta(const FInteractionFrameDelta& Delta)
+{
+	if (Delta.bFocusChanged)
 	{
-		PromptWidget->BP_SetPromptVisible(false);
-		PromptWidget->BP_SetHoldProgress(0.f);
+		HandleFocusChanged(Delta.FocusedActor, Delta.PreviousFocusedActor);
+	}
+
+	if (Delta.bQueryChanged)
+	{
+		HandleQueryUpdated(Delta.QueryResult);
+	}
+
+	if (Delta.bHoldChanged)
+	{
+		SetHoldProgress(Delta.bHolding ? Delta.HoldProgress : 0.f);
+	}
+
+	if (Delta.bHoldCompleted)
+	{
+		HandleHoldCompleted();
 	}
 }
 
@@ -132,36 +173,34 @@ void AInteractionFrameworkPlayerController::HandleQueryUpdated(const FInteractio
 	if (!PromptWidget) return;
 
 	const bool bVisible = Query.bShouldShowPrompt;
-	PromptWidget->BP_SetPromptVisible(bVisible);
+	SetPromptVisible(bVisible);
 
 	if (!bVisible)
 	{
-		PromptWidget->BP_SetHoldProgress(0.f);
+		SetHoldProgress(0.f);
 		return;
 	}
 
-	PromptWidget->BP_SetQueryResult(Query);
+	// Content is diffed against the last visible query, hidden queries never reach the widget.
+	const EInteractionQueryChange Changes = bHasPresentedQuery
+		? Query.GetChangesFrom(PresentedQuery)
+		: EInteractionQueryChange::All;
+
+	if (EnumHasAnyFlags(Changes, EInteractionQueryChange::Content))
+	{
+		PresentedQuery = Query;
+		bHasPresentedQuery = true;
+		PromptWidget->ApplyQueryChanges(Query, Changes);
+	}
 
 	// If press interaction, keep progress at 0. Because the progress bar exist in both interaction types. I
 	// t is cosmetic for the press interaction.
 	if (Query.InputType != EInteractionInputType::Hold)
 	{
-		PromptWidget->BP_SetHoldProgress(0.f);
+		SetHoldProgress(0.f);
 	}
 }
 
-void AInteractionFrameworkPlayerController::HandleHoldProgress(float Progress)
-{
-	if (!PromptWidget) return;
-	PromptWidget->BP_SetHoldProgress(Progress);
-}
-
-void AInteractionFrameworkPlayerController::HandleHoldReset()
-{
-	if (!PromptWidget) return;
-	PromptWidget->BP_SetHoldProgress(0.f);
-}
-
 void AInteractionFrameworkPlayerController::HandleHoldCompleted()
 {
 	// When the hold interaction is complete, the UI can be updated through here.
@@ -4,12 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "Interaction/Data/InteractionTypes.h"
 #include "InteractionFrameworkPlayerController.generated.h"
 
 class UInputMappingContext;
 class UUserWidget;
 class UInteractionComponent;
 class UInteractionPromptWidget;
+struct FInteractionFrameDelta;
 
 /**
  *  Simple first person Player Controller
@@ -55,23 +57,24 @@ private:
 	UPROPERTY()
 	UInteractionComponent* CachedInteractionComponent = nullptr;
 
+	/** Last state pushed to the prompt widget, used to skip redundant widget updates. */
+	FInteractionQueryResult PresentedQuery;
+	bool bHasPresentedQuery = false;
+	bool bPresentedPromptVisible = false;
+	float PresentedHoldProgress = 0.f;
+
 	void CreatePromptWidgetIfNeeded();
 	void BindToInteractionComponent(UInteractionComponent* InteractionComp);
 	void UnbindFromInteractionComponent();
 
-	// Callbacks from InteractionComponent
-	UFUNCTION()
-	void HandleFocusChanged(AActor* NewFocused, AActor* PrevFocused);
+	// Widget setters that only forward actual changes
+	void SetPromptVisible(bool bVisible);
+	void SetHoldProgress(float Progress);
+	void ResetPresentedPrompt();
 
-	UFUNCTION()
+	// Callbacks from InteractionComponent (coalesced once per frame)
+	void HandleFrameDelta(const FInteractionFrameDelta& Delta);
+	void HandleFocusChanged(AActor* NewFocused, AActor* PrevFocused);
 	void HandleQueryUpdated(const FInteractionQueryResult& Query);
-
-	UFUNCTION()
-	void HandleHoldProgress(float Progress);
-
-	UFUNCTION()
-	void HandleHoldReset();
-
-	UFUNCTION()
 	void HandleHoldCompleted();
 };